@@ -0,0 +1,526 @@
+/*
+ * TG19264Bench.c
+ *
+ * Bus transaction benchmark of public API, runs on host with simulated display.
+ * Build: gcc -O2 -DTG_HOST [library options] -Iinclude src/TG19264ALib.c src/TG19264Sim.c bench/TG19264Bench.c -o tg_bench
+ * Prints CSV (one row per case) to stdout:
+ * config,api,args,strobes,data_writes,data_reads,cmd_writes,addr_cmds,busy_polls,busy_violations,time_ns,pixels
+ * pixels is hash of screen content, it changes only when drawing result changes.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "TG19264ALib.h"
+#include "TG19264Config.h"
+#include "TG19264Sim.h"
+
+//library options this benchmark was built with (command line or TG19264Config.h)
+static const char config_name[] = "base"
+#ifdef TG_SHADOW_BUFFER
+	"+shadow"
+#endif
+#ifdef TG_DEFERRED_FLUSH
+	"+deferred"
+#endif
+#ifdef TG_BUSY_OPEN_LOOP
+	"+open_loop"
+#endif
+#if defined(TG_SHIFTED_FONT) && !defined(USE_CUSTOM)
+	"+shifted_font"
+#endif
+#ifdef USE_CUSTOM
+	"+custom_font"
+#endif
+#ifdef TG_STATS
+	"+stats"
+#endif
+#ifdef TG_BUS_HEADER
+	"+bus_header"
+#endif
+	;
+
+static uint8_t img_buff[2048];
+static uint8_t checks_failed; //cases which sent more data than expected or drew wrong result
+
+static uint32_t screen_hash(void)
+{
+	uint32_t hash = 2166136261u;
+	for (uint8_t x = 0; x < 192; x++)
+		for (uint8_t y = 0; y < 64; y++)
+			hash = (hash ^ tg_sim_pixel(x, y)) * 16777619u;
+	return hash;
+}
+
+//blank screen and zero counters before case
+static void bench_begin(void)
+{
+	TG_clear_full();
+	TG_flush();
+	tg_sim_clear_stats();
+}
+
+//flushes drawing (deferred mode) and prints counters of case
+static void bench_end(const char * api, const char * args)
+{
+	TG_flush();
+	printf("%s,%s,%s,%u,%u,%u,%u,%u,%u,%u,%llu,%08x\n", config_name, api, args,
+		tg_sim_stats.strobes, tg_sim_stats.data_writes, tg_sim_stats.data_reads,
+		tg_sim_stats.cmd_writes, tg_sim_stats.addr_cmds, tg_sim_stats.status_reads,
+		tg_sim_stats.busy_violations, (unsigned long long)tg_sim_stats.time_ns, screen_hash());
+}
+
+//reports case that wrote more data bytes than expected, call after bench_end
+static void bench_check_writes(const char * api, const char * args, uint32_t max_writes)
+{
+	if (tg_sim_stats.data_writes <= max_writes)
+		return;
+	fprintf(stderr, "check failed: %s %s wrote %u data bytes, expected %u\n", api, args, tg_sim_stats.data_writes, max_writes);
+	checks_failed++;
+}
+
+//reports case that left pixel (x,y) in other state than expected, call after bench_end
+static void bench_check_pixel(const char * api, const char * args, uint8_t x, uint8_t y, uint8_t lit)
+{
+	if (tg_sim_pixel(x, y) == lit)
+		return;
+	fprintf(stderr, "check failed: %s %s left pixel %u %u %s\n", api, args, x, y, lit ? "clear" : "lit");
+	checks_failed++;
+}
+
+/*
+Text path used before whole text composition, kept to compare with TG_printf in the same build:
+letters not aligned to page are drawn one by one through TG_image (every letter read back and
+written on its own), aligned text is streamed by TG_printf the same way as then. Bench label fits
+in one line, so letters aren't wrapped.
+*/
+static void printf_by_letters(uint8_t x, uint8_t y, uint8_t space, const char * txt)
+{
+	if (0 == y % 8)
+	{
+		TG_printf(x, y, 7, space, txt);
+		return;
+	}
+	for (; *txt != '\0'; txt++)
+	{
+		uint8_t code = *txt - TG_font_default.first;
+		TG_image(x, y, TG_font_default.width, 8, TG_font_default.bitmap + code * TG_font_default.width);
+		x += TG_font_default.width + space;
+	}
+}
+
+static void bench_clear(void)
+{
+	static const uint8_t x_w[][2] = {{0,8},{3,8},{60,8},{0,64},{3,100},{0,192}};
+	static const uint8_t y_h[][2] = {{0,8},{3,8},{5,30},{0,64}};
+	char args[32];
+	bench_begin();
+	TG_clear_full();
+	bench_end("TG_clear_full", "");
+	for (uint8_t i = 0; i < sizeof(x_w)/sizeof(x_w[0]); i++)
+	{
+		for (uint8_t j = 0; j < sizeof(y_h)/sizeof(y_h[0]); j++)
+		{
+			uint8_t x = x_w[i][0], w = x_w[i][1], y = y_h[j][0], h = y_h[j][1];
+			bench_begin();
+			TG_reverse_all(); //something to clear
+			TG_flush();
+			tg_sim_clear_stats();
+			TG_clear_area(x, y, x + w - 1, y + h - 1);
+			sprintf(args, "%u %u %u %u", x, y, x + w - 1, y + h - 1);
+			bench_end("TG_clear_area", args);
+		}
+	}
+}
+
+static void bench_fill(void)
+{
+	static const uint8_t boxes[][4] = {{3,3,100,30},{0,0,64,64},{10,20,150,8},{60,5,8,50},{0,8,192,48}};
+	static const char * modes[] = {"clear", "set", "invert"};
+	char args[32];
+	for (uint8_t i = 0; i < sizeof(boxes)/sizeof(boxes[0]); i++)
+	{
+		for (uint8_t mode = TG_fill_clear; mode <= TG_fill_invert; mode++)
+		{
+			bench_begin();
+			TG_reverse_all(); //half of pixels set, so every mode changes something
+			TG_fill_area(0, 0, 96, 64, TG_fill_invert);
+			TG_flush();
+			tg_sim_clear_stats();
+			TG_fill_area(boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3], mode);
+			sprintf(args, "%u %u %u %u %s", boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3], modes[mode]);
+			bench_end("TG_fill_area", args);
+		}
+	}
+	//bar 16 x 40 of bar graph drawn from lines and filled
+	bench_begin();
+	for (uint8_t x = 20; x < 36; x++)
+		TG_line(x, 4, x, 43);
+	bench_end("bar", "TG_line");
+	bench_begin();
+	TG_fill_area(20, 4, 16, 40, TG_fill_set);
+	bench_end("bar", "TG_fill_area");
+	//separate changes in one page of chip are sent as separate runs (deferred mode too)
+	bench_begin();
+	for (uint8_t x = 2; x < 60; x += 20)
+		TG_fill_area(x, 8, 4, 8, TG_fill_set);
+	bench_end("TG_fill_area", "3 spans in one page");
+	bench_check_writes("TG_fill_area", "3 spans in one page", 3 * 4);
+}
+
+static void bench_image(void)
+{
+	static const uint8_t w_h[][2] = {{5,8},{16,16},{32,24},{64,64},{192,64}};
+	static const uint8_t xs[] = {0, 3, 60, 130};
+	static const uint8_t ys[] = {0, 3};
+	char args[32];
+	for (uint8_t i = 0; i < sizeof(w_h)/sizeof(w_h[0]); i++)
+	{
+		for (uint8_t j = 0; j < sizeof(xs); j++)
+		{
+			for (uint8_t k = 0; k < sizeof(ys); k++)
+			{
+				uint8_t w = w_h[i][0], h = w_h[i][1], x = xs[j], y = ys[k];
+				if (x + w > 192 || y + h > 64)
+					continue;
+				bench_begin();
+				TG_image(x, y, w, h, img_buff + 256);
+				sprintf(args, "%u %u %u %u", x, y, w, h);
+				bench_end("TG_image", args);
+			}
+		}
+	}
+}
+
+//run-length codes data the way tools/TG19264Conv.c does, returns size
+static uint16_t rle_encode(const uint8_t * data, uint16_t size, uint8_t * out)
+{
+	uint16_t length = 0;
+	for (uint16_t i = 0; i < size; )
+	{
+		uint16_t run = 1;
+		while (i + run < size && run < 128 && data[i + run] == data[i])
+			run++;
+		if (run >= 2)
+		{
+			out[length++] = 0x80 | (run - 1);
+			out[length++] = data[i];
+			i += run;
+			continue;
+		}
+		uint16_t count = 1;
+		while (i + count < size && count < 128
+			&& !(i + count + 2 < size && data[i + count] == data[i + count + 1] && data[i + count] == data[i + count + 2]))
+			count++;
+		out[length++] = count - 1;
+		for (uint16_t j = 0; j < count; j++)
+			out[length++] = data[i + j];
+		i += count;
+	}
+	return length;
+}
+
+//mostly blank splash screen (frame and picture) and icon, raw and run-length coded
+static void bench_rle(void)
+{
+	static uint8_t splash[1536];
+	static uint8_t rle[2048];
+	char args[48];
+	for (uint8_t col = 0; col < 192; col++)
+	{
+		splash[col] = 0x01;
+		splash[7 * 192 + col] = 0x80;
+	}
+	for (uint8_t page = 0; page < 8; page++)
+		splash[page * 192] = splash[page * 192 + 191] = 0xFF;
+	for (uint8_t page = 3; page < 5; page++)
+		for (uint8_t col = 76; col < 116; col++)
+			splash[page * 192 + col] = img_buff[page * 40 + col];
+	uint16_t size = rle_encode(splash, sizeof(splash), rle);
+	bench_begin();
+	TG_image(0, 0, 192, 64, splash);
+	bench_end("TG_image", "splash 0 0 192 64");
+	bench_begin();
+	TG_image_rle(0, 0, 192, 64, rle);
+	sprintf(args, "splash 0 0 192 64 (%u bytes)", size);
+	bench_end("TG_image_rle", args);
+	size = rle_encode(img_buff + 256, 32 * 3, rle);
+	bench_begin();
+	TG_image(60, 3, 32, 24, img_buff + 256);
+	bench_end("TG_image", "icon 60 3 32 24");
+	bench_begin();
+	TG_image_rle(60, 3, 32, 24, rle);
+	sprintf(args, "icon 60 3 32 24 (%u bytes)", size);
+	bench_end("TG_image_rle", args);
+}
+
+static void bench_scroll(void)
+{
+	bench_begin();
+	TG_printf(0, 0, 7, 1, "last line of log");
+	TG_flush();
+	tg_sim_clear_stats();
+	TG_scroll_v(8);
+	bench_end("TG_scroll_v", "8");
+	TG_scroll_v(56); //back to start line 0
+}
+
+//frame rendered in RAM where only few digits change between frames
+static void bench_present(void)
+{
+	static uint8_t frame[1536];
+	memcpy(frame, img_buff, sizeof(frame));
+	bench_begin();
+	TG_present(frame);
+	bench_end("TG_present", "first frame");
+	for (uint8_t i = 0; i < 3; i++) //3 digits of 5 columns changed
+		for (uint8_t col = 0; col < 5; col++)
+			frame[3 * 192 + 20 + 40 * i + col] ^= 0x3E;
+	tg_sim_clear_stats();
+	TG_present(frame);
+	bench_end("TG_present", "3 digits changed");
+#if defined(TG_SHADOW_BUFFER) || defined(TG_DEFERRED_FLUSH)
+	bench_check_writes("TG_present", "3 digits changed", 3 * 5);
+#endif
+	tg_sim_clear_stats();
+	TG_image(0, 0, 192, 64, frame);
+	bench_end("TG_image", "3 digits changed");
+}
+
+//drawing between TG_poll calls which send one run of several chips in parts
+static void bench_poll(void)
+{
+	bench_begin();
+	TG_fill_area(0, 56, 192, 8, TG_fill_set);
+	TG_flush();
+	tg_sim_clear_stats();
+	TG_fill_area(0, 56, 192, 8, TG_fill_set); //same bytes on all chips, sent as one run
+	TG_poll(10);
+	TG_clear_area(20, 60, 20, 60); //first chip changes before rest of run is sent
+	bench_end("TG_poll", "drawing in joined run");
+	bench_check_pixel("TG_poll", "drawing in joined run", 20, 60, 0);
+	bench_check_pixel("TG_poll", "drawing in joined run", 84, 60, 1);
+	bench_check_pixel("TG_poll", "drawing in joined run", 148, 60, 1);
+}
+
+//appending line to event log: console against drawing all lines again
+static void bench_console(void)
+{
+	static const char * log_lines[] = {"12:00:01 door open", "12:00:04 door closed", "12:01:10 alarm armed",
+		"12:05:33 motion hall", "12:05:34 alarm", "12:05:40 code ok", "12:05:41 alarm off", "12:06:00 door open"};
+	bench_begin();
+	for (uint8_t i = 0; i < 8; i++)
+		TG_printf(0, 56 - 8 * i, 7, 1, log_lines[i]);
+	TG_flush();
+	tg_sim_clear_stats();
+	TG_clear_full();
+	for (uint8_t i = 0; i < 8; i++)
+		TG_printf(0, 56 - 8 * i, 7, 1, log_lines[(i + 1) % 8]);
+	bench_end("log redraw", "1 line");
+	bench_begin();
+	TG_console_init(0);
+	for (uint8_t i = 0; i < 8; i++)
+	{
+		TG_console_puts("\n");
+		TG_console_puts(log_lines[i]);
+	}
+	TG_flush();
+	tg_sim_clear_stats();
+	TG_console_puts("\n");
+	TG_console_puts(log_lines[0]);
+	bench_end("TG_console_puts", "1 line");
+	TG_console_init(0); //back to start line 0
+}
+
+static void bench_line(void)
+{
+	static const uint8_t pts[][4] = {
+		{10,5,40,5},		//short horizontal
+		{50,20,140,20},		//horizontal across chip boundary
+		{0,31,191,31},		//full width
+		{20,2,20,12},		//short vertical
+		{100,0,100,63},		//full height
+		{0,10,191,40},		//shallow
+		{30,0,50,63},		//steep
+		{0,0,63,63},		//diagonal inside chip
+		{40,0,160,63},		//diagonal across 3 chips
+		{3,60,150,2}};		//descending
+	char args[32];
+	for (uint8_t i = 0; i < sizeof(pts)/sizeof(pts[0]); i++)
+	{
+		bench_begin();
+		TG_line(pts[i][0], pts[i][1], pts[i][2], pts[i][3]);
+		sprintf(args, "%u %u %u %u", pts[i][0], pts[i][1], pts[i][2], pts[i][3]);
+		bench_end("TG_line", args);
+		if (pts[i][1] == pts[i][3])
+		{
+			bench_begin();
+			TG_hline(pts[i][0], pts[i][1], pts[i][2] - pts[i][0] + 1);
+			bench_end("TG_hline", args);
+		}
+		else if (pts[i][0] == pts[i][2])
+		{
+			bench_begin();
+			TG_vline(pts[i][0], pts[i][1], pts[i][3] - pts[i][1] + 1);
+			bench_end("TG_vline", args);
+		}
+	}
+}
+
+static void bench_rectangle(void)
+{
+	static const uint8_t rects[][4] = {{0,0,20,10},{10,3,50,20},{40,10,100,40},{0,0,191,63}};
+	char args[32];
+	for (uint8_t i = 0; i < sizeof(rects)/sizeof(rects[0]); i++)
+	{
+		bench_begin();
+		TG_rectangle(rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+		sprintf(args, "%u %u %u %u", rects[i][0], rects[i][1], rects[i][2], rects[i][3]);
+		bench_end("TG_rectangle", args);
+		bench_begin();
+		TG_rectangle_style(rects[i][0], rects[i][1], rects[i][2], rects[i][3], TG_rect_double | TG_rect_rounded);
+		bench_end("TG_rectangle_style", args);
+	}
+	//menu of 12 boxed items in 2 columns
+	bench_begin();
+	for (uint8_t i = 0; i < 12; i++)
+		TG_rectangle(2 + (i / 6) * 95, 1 + (i % 6) * 10, 90, 9);
+	bench_end("menu", "12 boxes");
+	static TG_cmd_st list[12];
+	bench_begin();
+	TG_list_begin(list, sizeof(list)/sizeof(list[0]));
+	for (uint8_t i = 0; i < 12; i++)
+		TG_rectangle(2 + (i / 6) * 95, 1 + (i % 6) * 10, 90, 9);
+	TG_list_end();
+	bench_end("menu", "12 boxes list");
+}
+
+static void bench_printf(void)
+{
+	static const char * texts[] = {"A", "Status: OK", "The quick brown fox jumps over."};
+	static const uint8_t xs[] = {0, 60};
+	static const uint8_t ys[] = {56, 27};
+	char args[48];
+	for (uint8_t i = 0; i < sizeof(texts)/sizeof(texts[0]); i++)
+	{
+		for (uint8_t j = 0; j < sizeof(xs); j++)
+		{
+			for (uint8_t k = 0; k < sizeof(ys); k++)
+			{
+				bench_begin();
+				TG_printf(xs[j], ys[k], 7, 1, texts[i]);
+				sprintf(args, "%u %u len=%u", xs[j], ys[k], (unsigned)strlen(texts[i]));
+				bench_end("TG_printf", args);
+			}
+		}
+	}
+}
+
+//long labels across all chips, aligned and shifted against pages
+static void bench_label(void)
+{
+	static const char label[] = "Long label across all 3 chips";
+	static const uint8_t ys[] = {0, 4, 21, 50};
+	char args[32];
+	for (uint8_t i = 0; i < 2 * sizeof(ys); i++)
+	{
+		uint8_t y = ys[i % sizeof(ys)];
+		bench_begin();
+		TG_fill_area(0, 0, 192, 64, TG_fill_set); //text has to keep pixels around letters
+		TG_fill_area(0, 0, 192, 64, TG_fill_invert);
+		TG_rectangle(0, 0, 191, 63);
+		TG_flush();
+		tg_sim_clear_stats();
+		sprintf(args, "5 %u len=%u", y, (unsigned)strlen(label));
+		if (i < sizeof(ys))
+		{
+			TG_printf(5, y, 7, 1, label);
+			bench_end("label", args);
+		}
+		else
+		{
+			printf_by_letters(5, y, 1, label);
+			bench_end("label by letters", args);
+		}
+	}
+}
+
+static void bench_reverse(void)
+{
+	static const uint8_t boxes[][4] = {{2,48,188,8},{2,45,188,9},{70,20,50,16}}; //menu item aligned, not aligned, box across chips
+	char args[32];
+	bench_begin();
+	TG_reverse_all();
+	bench_end("TG_reverse_all", "");
+	for (uint8_t i = 0; i < sizeof(boxes)/sizeof(boxes[0]); i++)
+	{
+		bench_begin();
+		TG_reverse_area(boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3]);
+		sprintf(args, "%u %u %u %u", boxes[i][0], boxes[i][1], boxes[i][2], boxes[i][3]);
+		bench_end("TG_reverse_area", args);
+	}
+}
+
+//status screen made of several primitives overlapping the same pages
+static void draw_scene(void)
+{
+	TG_clear_area(4, 4, 187, 59);
+	TG_rectangle(2, 2, 187, 59);
+	TG_printf(8, 48, 7, 1, "Temperature: 21.5 C");
+	TG_printf(8, 35, 7, 1, "Humidity:    40 %");
+	TG_line(8, 30, 183, 30);
+	TG_image(150, 8, 32, 16, img_buff + 512);
+	TG_printf(8, 11, 7, 1, "Battery low");
+}
+
+static void bench_list(void)
+{
+	static TG_cmd_st list[16];
+	bench_begin();
+	draw_scene();
+	bench_end("scene", "direct");
+	bench_begin();
+	TG_list_begin(list, sizeof(list)/sizeof(list[0]));
+	draw_scene();
+	TG_list_end();
+	bench_end("scene", "list");
+	bench_begin();
+	TG_list_begin(list, 4); //list drawn every 4 commands
+	draw_scene();
+	TG_list_end();
+	bench_end("scene", "list of 4");
+	bench_begin();
+	TG_list_begin(list, sizeof(list)/sizeof(list[0])); //list drawn from bottom page
+	TG_line(10, 2, 90, 60);
+	TG_line(100, 2, 180, 60);
+	TG_line(100, 50, 180, 10);
+	TG_list_end();
+	bench_end("chart", "list");
+}
+
+int main(void)
+{
+	uint32_t seed = 1;
+	for (uint16_t i = 0; i < sizeof(img_buff); i++)
+	{
+		seed = seed * 1103515245u + 12345u;
+		img_buff[i] = seed >> 16;
+	}
+	tg_sim_reset();
+	TG_init();
+	printf("config,api,args,strobes,data_writes,data_reads,cmd_writes,addr_cmds,busy_polls,busy_violations,time_ns,pixels\n");
+	bench_clear();
+	bench_fill();
+	bench_image();
+	bench_rle();
+	bench_line();
+	bench_rectangle();
+	bench_printf();
+	bench_label();
+	bench_reverse();
+	bench_scroll();
+	bench_poll();
+	bench_console();
+	bench_present();
+	bench_list();
+	return checks_failed ? 1 : 0;
+}
@@ -13,7 +13,87 @@
 #define TG_mid_disp (0x2)
 #define TG_right_disp (0x4)
 
+//modes of TG_fill_area
+#define TG_fill_clear (0x0)
+#define TG_fill_set (0x1)
+#define TG_fill_invert (0x2)
+
+//styles of TG_rectangle_style, sum for both
+#define TG_rect_double (0x1)
+#define TG_rect_rounded (0x2)
+
 #include <inttypes.h>
+
+//font for TG_printf_font, letters and tables are in program memory (TG_PROGMEM)
+typedef struct
+{
+	uint8_t first; //code of first letter
+	uint8_t last; //code of last letter
+	uint8_t pages; //height of letters in pages of 8 pixels
+	uint8_t width; //columns of every letter when widths is 0, codes out of font are blank of this width
+	const uint8_t * widths; //columns of every letter or 0 for fixed width
+	const uint16_t * offsets; //offset of every letter in bitmap, used with widths
+	const uint8_t * bitmap; //letters one by one, pages of width bytes each (like TG_image), LSB at top
+} TG_font_st;
+
+extern const TG_font_st TG_font_default; //5 x 8 font of codes 32..127 used by TG_printf
+
+//one command of display list, only storage for TG_list_begin
+typedef struct
+{
+	uint8_t type;
+	uint8_t x;
+	uint8_t y;
+	uint8_t w;
+	uint8_t h;
+	uint8_t arg;
+	const void * ptr;
+	const TG_font_st * font; //font of text
+} TG_cmd_st;
+
+//indexes of public functions in calls and time of TG_stats_st
+#define TG_stat_init (0)
+#define TG_stat_clear_area (1)
+#define TG_stat_fill_area (2)
+#define TG_stat_clear_full (3)
+#define TG_stat_image (4)
+#define TG_stat_image_P (5)
+#define TG_stat_image_rle (6)
+#define TG_stat_present (7)
+#define TG_stat_rectangle (8)
+#define TG_stat_rectangle_style (9)
+#define TG_stat_line (10)
+#define TG_stat_hline (11)
+#define TG_stat_vline (12)
+#define TG_stat_printf (13)
+#define TG_stat_printf_font (14)
+#define TG_stat_console_init (15)
+#define TG_stat_console_puts (16)
+#define TG_stat_turn_off (17)
+#define TG_stat_turn_on (18)
+#define TG_stat_scroll_v (19)
+#define TG_stat_get_stat (20)
+#define TG_stat_test (21)
+#define TG_stat_reverse_all (22)
+#define TG_stat_reverse_area (23)
+#define TG_stat_flush (24)
+#define TG_stat_poll (25)
+#define TG_stat_list_end (26)
+#define TG_stat_count (27)
+
+//counters of TG_get_stats, collected only when library is built with TG_STATS
+typedef struct
+{
+	uint32_t data_written; //display data bytes written
+	uint32_t data_read; //display data bytes read, dummy reads included
+	uint32_t commands; //instruction bytes (address, start line, on/off)
+	uint32_t addresses; //set_address calls (every part of page drawn)
+	uint32_t busy_spins; //busy flag polls which found display busy
+	uint16_t busy_spins_max; //most such polls in one wait, slow controllers show here
+	uint32_t calls[TG_stat_count]; //calls of every public function made by program, TG_stat_xxx index
+	uint32_t time[TG_stat_count]; //TG_TIMESTAMP ticks spent in every public function
+} TG_stats_st;
+
 /************************************************************************/
 /*Initialization of display interface and clearing screen               */
 /************************************************************************/
@@ -25,6 +105,12 @@ PointA(X,Y) and ends at PointB(X,Y)							*/
 /************************************************************************/
 void TG_clear_area(uint8_t A_x, uint8_t A_y, uint8_t B_x, uint8_t B_y);
 
+/************************************************************************/
+/* Sets, clears or inverts (mode TG_fill_set/clear/invert) all pixels of
+box w x h that starts at (posX,posY)                                    */
+/************************************************************************/
+void TG_fill_area(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t mode);
+
 /************************************************************************/
 /* Clears full display                                                  */
 /************************************************************************/
@@ -36,22 +122,77 @@ characters                                                     */
 /************************************************************************/
 void TG_image(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * img_ptr);
 
+/************************************************************************/
+/* Draws image like TG_image, img_ptr points to program memory (array
+declared with PROGMEM on AVR, see TG_PROGMEM in TG19264Config.h)        */
+/************************************************************************/
+void TG_image_P(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * img_ptr);
+
+/************************************************************************/
+/* Draws image like TG_image_P from run-length coded data in program
+memory (made by tools/TG19264Conv.c), commands recorded into display
+list are drawn before it                                                */
+/************************************************************************/
+void TG_image_rle(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * rle_ptr);
+
+/************************************************************************/
+/* Shows frame of whole display (192 x 64 in TG_image layout). With
+TG_SHADOW_BUFFER only bytes changed since display was drawn are sent,
+without it whole frame is written                                       */
+/************************************************************************/
+void TG_present(const uint8_t * frame);
+
 /************************************************************************/
 /* Draws rectangle at (posX,posY) of size sizeX x sizeY                 */
 /************************************************************************/
 void TG_rectangle(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size);
 
+/************************************************************************/
+/* Draws rectangle like TG_rectangle, style TG_rect_double adds second
+outline 2 pixels inside, TG_rect_rounded cuts corners                   */
+/************************************************************************/
+void TG_rectangle_style(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, uint8_t style);
+
 /************************************************************************/
 /* Draws line from point A(posXpointA,posYpointA) to 
 point B(posXpointB,posYpointB)                                          */
 /************************************************************************/
 void TG_line(uint8_t A_x, uint8_t A_y, uint8_t B_x, uint8_t B_y);
 
+/************************************************************************/
+/* Draws horizontal line from (posX,posY) to the right, length in pixels */
+/************************************************************************/
+void TG_hline(uint8_t x, uint8_t y, uint8_t length);
+
+/************************************************************************/
+/* Draws vertical line from (posX,posY) up, length in pixels            */
+/************************************************************************/
+void TG_vline(uint8_t x, uint8_t y, uint8_t length);
+
 /************************************************************************/
 /* Writes text from (posX,posY) with given height of letters and space between them in pixels */
 /************************************************************************/
 void TG_printf(uint8_t x, uint8_t y, uint8_t height, uint8_t space, const char * txt);
 
+/************************************************************************/
+/* Writes text like TG_printf in given font (8, 16, 24... pixels high,
+fixed or proportional width), see TG_font_st                            */
+/************************************************************************/
+void TG_printf_font(uint8_t x, uint8_t y, const TG_font_st * font, uint8_t space, const char * txt);
+
+/************************************************************************/
+/* Clears display and starts console: text of TG_console_puts is written
+to bottom line in font (one page high, 0 for TG_font_default)           */
+/************************************************************************/
+void TG_console_init(const TG_font_st * font);
+
+/************************************************************************/
+/* Appends text to console, new line character or full line moves lines
+up with TG_scroll_v (oldest line is cleared), so new line costs one page
+write instead of drawing whole screen again                             */
+/************************************************************************/
+void TG_console_puts(const char * txt);
+
 /************************************************************************/
 /* Turns display off, chipID for selecting part 1=left 2=middle 4=right 
 sum for simultaneously turning few segments*/
@@ -64,6 +205,17 @@ sum for simultaneously turning few segments*/
 /************************************************************************/
 void TG_turn_on(uint8_t chip_id);
 
+/************************************************************************/
+/* Scrolls content of display up by lines (8, 16 .. 56) with start line
+of all chips, lines scrolled out at top come back at bottom. Drawing
+functions keep using screen coordinates. Lines not multiple of 8 are
+ignored (page of display RAM can't be split between pages of screen).
+Commands recorded into display list are drawn before it. In
+TG_DEFERRED_FLUSH mode start line is sent by TG_flush/TG_poll after data
+drawn before it, drawing after it can't hold it back                   */
+/************************************************************************/
+void TG_scroll_v(uint8_t lines);
+
 /************************************************************************/
 /* Get display status, chipID for selecting part 1=left 2=middle 4=right
 sum not allowed!*/
@@ -80,4 +232,61 @@ void TG_test(void);
 /************************************************************************/
 void TG_reverse_all(void);
 
+/************************************************************************/
+/* Changes states of pixels in box w x h that starts at (posX,posY), like
+TG_fill_area with TG_fill_invert                                        */
+/************************************************************************/
+void TG_reverse_area(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+
+/************************************************************************/
+/* Sends to display everything drawn since last call (TG_DEFERRED_FLUSH
+mode), changed columns of every page are written in one run per chip.
+Does nothing in other modes                                             */
+/************************************************************************/
+void TG_flush(void);
+
+/************************************************************************/
+/* Sends at most max_bytes of data drawn since last flush (TG_DEFERRED_FLUSH
+mode) and returns, can be called from main loop or timer interrupt.
+Returns 1 when display shows everything drawn (max_bytes 0 only checks).
+When called from interrupt, other functions sending commands (TG_turn_on/off,
+TG_get_stat, TG_test, TG_flush) may be used only after
+TG_poll returned 1 or with that interrupt disabled. Returns 1 in other modes */
+/************************************************************************/
+uint8_t TG_poll(uint8_t max_bytes);
+
+/************************************************************************/
+/* Sets function called by TG_poll (from its context) when all data drawn
+has been sent, NULL disables. Not used in other modes than TG_DEFERRED_FLUSH */
+/************************************************************************/
+void TG_set_flush_callback(void (*callback)(void));
+
+/************************************************************************/
+/* Copies counters collected since start or TG_reset_stats into stats.
+Without TG_STATS counters aren't collected and stats is zeroed          */
+/************************************************************************/
+void TG_get_stats(TG_stats_st * stats);
+
+/************************************************************************/
+/* Zeroes counters of TG_get_stats                                      */
+/************************************************************************/
+void TG_reset_stats(void);
+
+/************************************************************************/
+/* Starts display list: TG_clear_area, TG_fill_area, TG_clear_full,
+TG_image(_P), TG_line, TG_hline, TG_vline, TG_rectangle(_style),
+TG_printf(_font), TG_reverse_all and TG_reverse_area called after it are
+only recorded into list of size commands. Images, texts and fonts given
+have to stay valid till list is drawn.
+Full list is drawn and recording continues from its start              */
+/************************************************************************/
+void TG_list_begin(TG_cmd_st * list, uint8_t size);
+
+/************************************************************************/
+/* Draws recorded commands page by page and chip by chip, every changed
+part of page is read back once and written once with all commands drawn
+in order of recording. Functions draw directly again after it           */
+/************************************************************************/
+void TG_list_end(void);
+
 #endif /* TG19264A_ATMEGADRIVER_H_ */
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+ * TG19264Bus.h
+ *
+ * Bus backend: macros driving display lines, used by library only.
+ * Default backend writes port registers configured in TG19264Config.h (ATmega section or
+ * simulated ports of TG_HOST), every line change is one port operation inlined in place.
+ * For other MCUs or port expanders define TG_BUS_HEADER as name of header with the same
+ * macros (e.g. -DTG_BUS_HEADER='"my_bus.h"'), they can call static inline functions of it.
+ * Port configuration section of TG19264Config.h isn't needed then, delays are.
+ *
+ * TG_BUS_INIT()            data lines output, control lines (RS RW E CS1 CS2 CS3 RES) output low
+ * TG_BUS_DATA_INPUT()      data lines input with pull-ups (before status or data read)
+ * TG_BUS_DATA_OUTPUT()     data lines output low (after read)
+ * TG_BUS_WRITE(byte)       puts byte on data lines
+ * TG_BUS_READ()            value of data lines
+ * TG_BUS_E_TOGGLE()        toggles E line
+ * TG_BUS_RES_TOGGLE()      toggles RES line
+ * TG_BUS_RS_DATA()         RS high (data)
+ * TG_BUS_RS_CMD()          RS low (command)
+ * TG_BUS_RS_STATE()        non zero when RS is high
+ * TG_BUS_RW_READ()         RW high
+ * TG_BUS_RW_WRITE()        RW low
+ * TG_BUS_CSn_SELECT()      asserts CS line of chip n (1..3), TG_BUS_CSn_DESELECT() releases it
+ */
+
+#ifndef TG19264BUS_H_
+#define TG19264BUS_H_
+
+#ifdef TG_BUS_HEADER
+#include TG_BUS_HEADER
+#else
+
+#define TG_BUS_INIT() do { \
+	DATA_DDR = OUTPUT_8BIT; \
+	DATA_PORT = 0; \
+	RS_PIN_DDR |= OUTPUT << RS_PIN_NUM; \
+	RS_PIN_PORT &= ~(1 << RS_PIN_NUM); \
+	RW_PIN_DDR |= OUTPUT << RW_PIN_NUM; \
+	RW_PIN_PORT &= ~(1 << RW_PIN_NUM); \
+	E_PIN_DDR |= OUTPUT << E_PIN_NUM; \
+	E_PIN_PORT &= ~(1 << E_PIN_NUM); \
+	CS1_PIN_DDR |= OUTPUT << CS1_PIN_NUM; \
+	CS1_PIN_PORT &= ~(1 << CS1_PIN_NUM); \
+	CS2_PIN_DDR |= OUTPUT << CS2_PIN_NUM; \
+	CS2_PIN_PORT &= ~(1 << CS2_PIN_NUM); \
+	CS3_PIN_DDR |= OUTPUT << CS3_PIN_NUM; \
+	CS3_PIN_PORT &= ~(1 << CS3_PIN_NUM); \
+	RES_PIN_DDR |= OUTPUT << RES_PIN_NUM; \
+	RES_PIN_PORT &= ~(1 << RES_PIN_NUM); \
+} while (0)
+
+#define TG_BUS_DATA_INPUT() do { DATA_DDR = INPUT_8BIT; DATA_PORT = PULLUP_8BIT; } while (0)
+#define TG_BUS_DATA_OUTPUT() do { DATA_PORT = 0; DATA_DDR = OUTPUT_8BIT; } while (0)
+#define TG_BUS_WRITE(byte) (DATA_PORT = (byte))
+#define TG_BUS_READ() (DATA_READ)
+
+#define TG_BUS_E_TOGGLE() (E_PIN_PORT ^= 1 << E_PIN_NUM)
+#define TG_BUS_RES_TOGGLE() (RES_PIN_PORT ^= 1 << RES_PIN_NUM)
+
+#define TG_BUS_RS_DATA() (RS_PIN_PORT |= 1 << RS_PIN_NUM)
+#define TG_BUS_RS_CMD() (RS_PIN_PORT &= ~(1 << RS_PIN_NUM))
+#define TG_BUS_RS_STATE() ((1 << RS_PIN_NUM) & RS_PIN_READ)
+#define TG_BUS_RW_READ() (RW_PIN_PORT |= 1 << RW_PIN_NUM)
+#define TG_BUS_RW_WRITE() (RW_PIN_PORT &= ~(1 << RW_PIN_NUM))
+
+#define TG_BUS_CS1_SELECT() (CS1_PIN_PORT &= ~(1 << CS1_PIN_NUM))
+#define TG_BUS_CS1_DESELECT() (CS1_PIN_PORT |= 1 << CS1_PIN_NUM)
+#define TG_BUS_CS2_SELECT() (CS2_PIN_PORT &= ~(1 << CS2_PIN_NUM))
+#define TG_BUS_CS2_DESELECT() (CS2_PIN_PORT |= 1 << CS2_PIN_NUM)
+#define TG_BUS_CS3_SELECT() (CS3_PIN_PORT &= ~(1 << CS3_PIN_NUM))
+#define TG_BUS_CS3_DESELECT() (CS3_PIN_PORT |= 1 << CS3_PIN_NUM)
+
+#endif // TG_BUS_HEADER
+
+#endif /* TG19264BUS_H_ */
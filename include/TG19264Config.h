@@ -12,6 +12,8 @@ CS1_PIN - 1 bit output port
 CS2_PIN - 1 bit output port
 CS3_PIN  - 1 bit output port
 RES_PIN - 1 bit output port
+Sections below map them onto port registers for default bus backend (TG19264Bus.h),
+with TG_BUS_HEADER defined they aren't needed.
 */
 
 #ifdef ATmega
@@ -84,10 +86,71 @@ INPUT_8BIT <-value to set 8 bits as input (used by DATA)
 
 #endif // ATmega
 
+#ifdef TG_HOST
+/*
+Section with configuration for host (PC) builds.
+Pins are mapped onto registers of simulated display from TG19264Sim.h,
+simulator decodes every E strobe the same way KS0108 controllers do.
+*/
+#include "TG19264Sim.h"
+
+//Data Port
+#define DATA_PORT	tg_sim_reg.data_port
+#define DATA_DDR	tg_sim_reg.data_ddr
+#define DATA_READ	tg_sim_reg.data_pin
+
+//RS_PIN
+#define RS_PIN_PORT	tg_sim_reg.ctrl_port
+#define RS_PIN_DDR	tg_sim_reg.ctrl_ddr
+#define RS_PIN_NUM	TG_SIM_RS
+#define RS_PIN_READ tg_sim_reg.ctrl_port
+
+//RW_PIN
+#define RW_PIN_PORT	tg_sim_reg.ctrl_port
+#define RW_PIN_DDR	tg_sim_reg.ctrl_ddr
+#define RW_PIN_NUM	TG_SIM_RW
+
+//E_PIN
+#define E_PIN_PORT	tg_sim_reg.ctrl_port
+#define E_PIN_DDR	tg_sim_reg.ctrl_ddr
+#define E_PIN_NUM	TG_SIM_E
+
+//CS1_PIN
+#define CS1_PIN_PORT  tg_sim_reg.ctrl_port
+#define CS1_PIN_DDR	  tg_sim_reg.ctrl_ddr
+#define CS1_PIN_NUM	  TG_SIM_CS1
+
+//CS2_PIN
+#define CS2_PIN_PORT  tg_sim_reg.ctrl_port
+#define CS2_PIN_DDR	  tg_sim_reg.ctrl_ddr
+#define CS2_PIN_NUM	  TG_SIM_CS2
+
+//CS3_PIN
+#define CS3_PIN_PORT  tg_sim_reg.ctrl_port
+#define CS3_PIN_DDR   tg_sim_reg.ctrl_ddr
+#define CS3_PIN_NUM   TG_SIM_CS3
+
+//RES_PIN
+#define RES_PIN_PORT  tg_sim_reg.ctrl_port
+#define RES_PIN_DDR   tg_sim_reg.ctrl_ddr
+#define RES_PIN_NUM   TG_SIM_RES
+
+//Pin states
+#define OUTPUT 1
+#define INPUT 0
+
+//DATA states
+#define OUTPUT_8BIT 0xFF
+#define INPUT_8BIT 0x0
+#define PULLUP_8BIT 0xFF
+
+#endif // TG_HOST
+
 /*
 Delay configuration:
 Add suitable header file with delays function and define clock freq if needed
 */
+#ifndef TG_HOST
 #define F_CPU 16000000UL
 #include <util/delay.h>
 
@@ -97,5 +160,97 @@ Add suitable header file with delays function and define clock freq if needed
 #define DELAY_200NS asm("nop"); asm("nop"); asm("nop"); asm("nop"); asm("nop")
 //can't be nothing (interface works with 40 ns min (checked) )
 #define DELAY_STROBE_FAST asm("nop")
+//time display stays busy after data/address byte, used only in TG_BUSY_OPEN_LOOP mode
+#define DELAY_BUSY DELAY_US(2)
+
+//interrupt lock used in deferred mode to protect data shared with TG_poll called from interrupt
+#include <avr/interrupt.h>
+#define TG_LOCK uint8_t tg_sreg = SREG; cli()
+#define TG_UNLOCK SREG = tg_sreg
+
+//fonts and TG_image_P bitmaps are kept in program memory and read with TG_READ_BYTE
+//(to keep them in RAM define TG_PROGMEM empty and TG_READ_BYTE as plain read like host does)
+#include <avr/pgmspace.h>
+#define TG_PROGMEM PROGMEM
+#define TG_READ_BYTE(ptr) pgm_read_byte(ptr)
+#define TG_READ_WORD(ptr) pgm_read_word(ptr)
+#else
+//simulated delays, strobe delays also pass E line edge to simulator
+#define DELAY_MS(x) (tg_sim_delay_ns((x) * 1000000UL))
+#define DELAY_US(x) (tg_sim_delay_ns((x) * 1000UL))
+#define DELAY_200NS tg_sim_strobe(200)
+#define DELAY_STROBE_FAST tg_sim_strobe(40)
+#define DELAY_BUSY tg_sim_delay_ns(TG_SIM_BUSY_NS)
+#define TG_LOCK
+#define TG_UNLOCK
+#define TG_TIMESTAMP() ((uint32_t)tg_sim_stats.time_ns) //modelled bus time, ns
+#define TG_PROGMEM
+#define TG_READ_BYTE(ptr) (*(const uint8_t *)(ptr))
+#define TG_READ_WORD(ptr) (*(const uint16_t *)(ptr))
+#endif // TG_HOST
+
+/*
+Library options (uncomment or define in compiler options):
+TG_SHADOW_BUFFER <- keeps copy of display RAM (1536 bytes) in MCU memory. Functions which change
+only part of page (clear area, image, line, reverse) compose data in copy instead of reading it
+back from display, so display is only written to. TG_init clears display to synchronize copy.
+*/
+//#define TG_SHADOW_BUFFER
+
+/*
+TG_DEFERRED_FLUSH <- drawing functions change only shadow buffer (defined automatically) and mark
+changed columns of every page (bit per column, 192 bytes), nothing is sent until TG_flush() is called.
+Separate changes of page are sent as separate runs, gaps are rewritten only when cheaper (TG_COST_CMD).
+Commands (turn on/off, status) are still executed immediately, start line of TG_scroll_v is sent with
+flush. TG_poll(max_bytes) sends changes in bounded portions instead, from main loop or timer interrupt
+(TG_LOCK/TG_UNLOCK guard data shared with it). Its scan goes round pages of all chips, start line is sent
+when scan passed all data drawn before scroll.
+*/
+//#define TG_DEFERRED_FLUSH
+
+/*
+TG_BUSY_OPEN_LOOP <- data and address bytes are followed by fixed DELAY_BUSY instead of polling
+busy flag after every byte (which needs switching DATA port direction twice). Busy flag is still
+polled after on/off and start line commands. DELAY_BUSY has to cover busy time of used controllers
+(datasheet value or calibrated with TG_test).
+*/
+//#define TG_BUSY_OPEN_LOOP
+
+/*
+TG_COST_CMD, TG_COST_DATA <- bus time of column address command and of data byte in any unit,
+TG_present rewrites unchanged bytes between changed ones when it costs less than new address.
+*/
+#ifndef TG_COST_CMD
+#define TG_COST_CMD 1
+#endif
+#ifndef TG_COST_DATA
+#define TG_COST_DATA 1
+#endif
+
+/*
+TG_SHIFTED_FONT <- letters of default font not aligned to page are copied from tables shifted at
+build time (TG19264FontShift.h, about 6.7 KB of flash) instead of shifting every column byte.
+Generate tables again with tools/TG19264FontGen.c after default font is changed.
+*/
+//#define TG_SHIFTED_FONT
+
+/*
+USE_CUSTOM <- built-in font table of TG19264Fonts.h (codes 32..127) is replaced by table defined by user:
+const uint8_t default_f[128][5] TG_PROGMEM, 5 columns (LSB at top) of every code 0..127 like in previous
+versions. TG_printf and TG_font_default use it, TG_SHIFTED_FONT is ignored.
+*/
+//#define USE_CUSTOM
+
+/*
+TG_STATS <- library counts data bytes written and read, instructions, address setting, busy flag
+polls that found display busy (total and most in one wait), calls of every public function made by
+program and time spent in them (library doesn't count its own use of them), see TG_get_stats(). TG_TIMESTAMP() returns uint32_t time in any unit (timer
+ticks, us) for it, without it only calls are counted. Counters are updated inside TG_LOCK/TG_UNLOCK,
+so they stay exact when TG_poll runs from interrupt. Costs about 240 bytes of RAM.
+*/
+//#define TG_STATS
+#ifndef TG_TIMESTAMP
+#define TG_TIMESTAMP() 0
+#endif
 
 #endif //__TG19264A_CONFIG__
\ No newline at end of file
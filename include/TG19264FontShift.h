@@ -0,0 +1,712 @@
+/*
+ * TG19264FontShift.h
+ *
+ * Generated by tools/TG19264FontGen.c from default_f, do not edit.
+ */
+
+#ifndef FONT_SHIFT_H_
+#define FONT_SHIFT_H_
+
+//letter at row y (y % 8 = shift) covers 2 pages, [shift - 1][half] is part in page of
+//its top row (half 0) or of row y (half 1)
+const uint8_t default_f_shift_mask[7][2] TG_PROGMEM = {
+	{0x80,0x7F}, //shift 1
+	{0xC0,0x3F}, //shift 2
+	{0xE0,0x1F}, //shift 3
+	{0xF0,0x0F}, //shift 4
+	{0xF8,0x07}, //shift 5
+	{0xFC,0x03}, //shift 6
+	{0xFE,0x01}, //shift 7
+};
+
+//columns of letters 32..127, [shift - 1][code - 32][half]
+const uint8_t default_f_shift[7][96][2][5] TG_PROGMEM = {
+	{ //shift 1
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0x80,0x00,0x00},{0x00,0x00,0x27,0x00,0x00}}, //code[33]
+		{{0x00,0x80,0x00,0x80,0x00},{0x00,0x03,0x00,0x03,0x00}}, //code[34]
+		{{0x00,0x80,0x00,0x80,0x00},{0x0A,0x3F,0x0A,0x3F,0x0A}}, //code[35]
+		{{0x00,0x00,0x80,0x00,0x00},{0x12,0x15,0x3F,0x15,0x09}}, //code[36]
+		{{0x80,0x80,0x00,0x00,0x00},{0x11,0x09,0x04,0x32,0x31}}, //code[37]
+		{{0x00,0x80,0x80,0x00,0x00},{0x1B,0x24,0x2A,0x11,0x28}}, //code[38]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x02,0x01,0x00,0x00}}, //code[39]
+		{{0x00,0x00,0x00,0x80,0x00},{0x00,0x0E,0x11,0x20,0x00}}, //code[40]
+		{{0x00,0x80,0x00,0x00,0x00},{0x00,0x20,0x11,0x0E,0x00}}, //code[41]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0A,0x04,0x1F,0x04,0x0A}}, //code[42]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x04,0x1F,0x04,0x04}}, //code[43]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x28,0x18,0x00,0x00}}, //code[44]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x04,0x04,0x04,0x04}}, //code[45]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x30,0x30,0x00,0x00}}, //code[46]
+		{{0x00,0x00,0x00,0x00,0x00},{0x10,0x08,0x04,0x02,0x01}}, //code[47]
+		{{0x00,0x80,0x80,0x80,0x00},{0x3F,0x28,0x24,0x22,0x3F}}, //code[48]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x21,0x3F,0x20,0x00}}, //code[49]
+		{{0x00,0x80,0x80,0x80,0x00},{0x21,0x30,0x28,0x24,0x23}}, //code[50]
+		{{0x80,0x80,0x80,0x80,0x80},{0x10,0x20,0x22,0x25,0x18}}, //code[51]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0C,0x0A,0x09,0x3F,0x08}}, //code[52]
+		{{0x80,0x80,0x80,0x80,0x80},{0x13,0x22,0x22,0x22,0x1C}}, //code[53]
+		{{0x00,0x00,0x80,0x80,0x00},{0x1E,0x25,0x24,0x24,0x18}}, //code[54]
+		{{0x80,0x80,0x80,0x80,0x80},{0x00,0x38,0x04,0x02,0x01}}, //code[55]
+		{{0x00,0x80,0x80,0x80,0x00},{0x1B,0x24,0x24,0x24,0x1B}}, //code[56]
+		{{0x00,0x80,0x80,0x80,0x00},{0x03,0x24,0x24,0x14,0x0F}}, //code[57]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x1B,0x1B,0x00,0x00}}, //code[58]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x2B,0x1B,0x00,0x00}}, //code[59]
+		{{0x00,0x00,0x00,0x80,0x00},{0x04,0x0A,0x11,0x20,0x00}}, //code[60]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0A,0x0A,0x0A,0x0A,0x0A}}, //code[61]
+		{{0x00,0x80,0x00,0x00,0x00},{0x00,0x20,0x11,0x0A,0x04}}, //code[62]
+		{{0x00,0x80,0x80,0x80,0x00},{0x01,0x00,0x28,0x04,0x03}}, //code[63]
+		{{0x00,0x80,0x80,0x80,0x00},{0x19,0x24,0x3C,0x20,0x1F}}, //code[64]
+		{{0x00,0x80,0x80,0x80,0x00},{0x3F,0x08,0x08,0x08,0x3F}}, //code[65]
+		{{0x80,0x80,0x80,0x80,0x00},{0x3F,0x24,0x24,0x24,0x1B}}, //code[66]
+		{{0x00,0x80,0x80,0x80,0x00},{0x1F,0x20,0x20,0x20,0x11}}, //code[67]
+		{{0x80,0x80,0x80,0x00,0x00},{0x3F,0x20,0x20,0x11,0x0E}}, //code[68]
+		{{0x80,0x80,0x80,0x80,0x80},{0x3F,0x24,0x24,0x24,0x20}}, //code[69]
+		{{0x80,0x80,0x80,0x80,0x80},{0x3F,0x04,0x04,0x04,0x00}}, //code[70]
+		{{0x00,0x80,0x80,0x80,0x00},{0x1F,0x20,0x24,0x24,0x3D}}, //code[71]
+		{{0x80,0x00,0x00,0x00,0x80},{0x3F,0x04,0x04,0x04,0x3F}}, //code[72]
+		{{0x00,0x80,0x80,0x80,0x00},{0x00,0x20,0x3F,0x20,0x00}}, //code[73]
+		{{0x00,0x00,0x80,0x80,0x80},{0x10,0x20,0x20,0x3F,0x00}}, //code[74]
+		{{0x80,0x00,0x00,0x00,0x80},{0x3F,0x04,0x0A,0x11,0x20}}, //code[75]
+		{{0x80,0x00,0x00,0x00,0x00},{0x3F,0x20,0x20,0x20,0x20}}, //code[76]
+		{{0x80,0x00,0x00,0x00,0x80},{0x3F,0x01,0x06,0x01,0x3F}}, //code[77]
+		{{0x80,0x00,0x00,0x00,0x80},{0x3F,0x02,0x04,0x08,0x3F}}, //code[78]
+		{{0x00,0x80,0x80,0x80,0x00},{0x1F,0x20,0x20,0x20,0x1F}}, //code[79]
+		{{0x80,0x80,0x80,0x80,0x00},{0x3F,0x04,0x04,0x04,0x03}}, //code[80]
+		{{0x00,0x80,0x80,0x80,0x00},{0x1F,0x20,0x28,0x10,0x2F}}, //code[81]
+		{{0x00,0x80,0x80,0x80,0x00},{0x3F,0x04,0x0C,0x14,0x23}}, //code[82]
+		{{0x00,0x80,0x80,0x80,0x80},{0x23,0x24,0x24,0x24,0x18}}, //code[83]
+		{{0x80,0x80,0x80,0x80,0x80},{0x00,0x00,0x3F,0x00,0x00}}, //code[84]
+		{{0x80,0x00,0x00,0x00,0x80},{0x1F,0x20,0x20,0x20,0x1F}}, //code[85]
+		{{0x80,0x00,0x00,0x00,0x80},{0x0F,0x10,0x20,0x10,0x0F}}, //code[86]
+		{{0x80,0x00,0x00,0x00,0x80},{0x1F,0x20,0x1C,0x20,0x1F}}, //code[87]
+		{{0x80,0x00,0x00,0x00,0x80},{0x31,0x0A,0x04,0x0A,0x31}}, //code[88]
+		{{0x80,0x00,0x00,0x00,0x80},{0x03,0x04,0x38,0x04,0x03}}, //code[89]
+		{{0x80,0x80,0x80,0x80,0x80},{0x30,0x28,0x24,0x22,0x21}}, //code[90]
+		{{0x00,0x80,0x80,0x80,0x00},{0x00,0x20,0x20,0x3F,0x00}}, //code[91]
+		{{0x80,0x00,0x00,0x00,0x80},{0x0A,0x0B,0x3E,0x0B,0x0A}}, //code[92]
+		{{0x00,0x80,0x80,0x80,0x00},{0x00,0x3F,0x20,0x20,0x00}}, //code[93]
+		{{0x00,0x00,0x80,0x00,0x00},{0x02,0x01,0x00,0x01,0x02}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x20,0x20,0x20,0x20,0x20}}, //code[95]
+		{{0x00,0x80,0x00,0x00,0x00},{0x00,0x00,0x01,0x02,0x00}}, //code[96]
+		{{0x00,0x00,0x00,0x00,0x00},{0x10,0x2A,0x2A,0x2A,0x3C}}, //code[97]
+		{{0x80,0x00,0x00,0x00,0x00},{0x3F,0x24,0x22,0x22,0x1C}}, //code[98]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1C,0x22,0x22,0x22,0x10}}, //code[99]
+		{{0x00,0x00,0x00,0x00,0x80},{0x1C,0x22,0x22,0x24,0x3F}}, //code[100]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1C,0x2A,0x2A,0x2A,0x0C}}, //code[101]
+		{{0x00,0x00,0x80,0x80,0x00},{0x04,0x3F,0x04,0x00,0x01}}, //code[102]
+		{{0x00,0x00,0x00,0x00,0x00},{0x06,0x29,0x29,0x29,0x1F}}, //code[103]
+		{{0x80,0x00,0x00,0x00,0x00},{0x3F,0x04,0x02,0x02,0x3C}}, //code[104]
+		{{0x00,0x00,0x80,0x00,0x00},{0x00,0x22,0x3E,0x20,0x00}}, //code[105]
+		{{0x00,0x00,0x00,0x80,0x00},{0x10,0x20,0x22,0x1E,0x00}}, //code[106]
+		{{0x80,0x00,0x00,0x00,0x00},{0x3F,0x08,0x14,0x22,0x00}}, //code[107]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x20,0x3F,0x20,0x00}}, //code[108]
+		{{0x00,0x00,0x00,0x00,0x00},{0x3E,0x02,0x0C,0x02,0x3C}}, //code[109]
+		{{0x00,0x00,0x00,0x00,0x00},{0x3E,0x04,0x02,0x02,0x3C}}, //code[110]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1C,0x22,0x22,0x22,0x1C}}, //code[111]
+		{{0x00,0x00,0x00,0x00,0x00},{0x3E,0x0A,0x0A,0x0A,0x04}}, //code[112]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x0A,0x0A,0x0C,0x3E}}, //code[113]
+		{{0x00,0x00,0x00,0x00,0x00},{0x3E,0x04,0x02,0x02,0x04}}, //code[114]
+		{{0x00,0x00,0x00,0x00,0x00},{0x24,0x2A,0x2A,0x2A,0x10}}, //code[115]
+		{{0x00,0x80,0x00,0x00,0x00},{0x02,0x1F,0x22,0x20,0x10}}, //code[116]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1E,0x20,0x20,0x10,0x3E}}, //code[117]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0E,0x10,0x20,0x10,0x0E}}, //code[118]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1E,0x20,0x18,0x20,0x1E}}, //code[119]
+		{{0x00,0x00,0x00,0x00,0x00},{0x22,0x14,0x08,0x14,0x22}}, //code[120]
+		{{0x00,0x00,0x00,0x00,0x00},{0x06,0x28,0x28,0x28,0x1E}}, //code[121]
+		{{0x00,0x00,0x00,0x00,0x00},{0x22,0x32,0x2A,0x26,0x22}}, //code[122]
+		{{0x00,0x00,0x00,0x80,0x00},{0x00,0x04,0x1B,0x20,0x00}}, //code[123]
+		{{0x00,0x00,0x80,0x00,0x00},{0x00,0x00,0x3F,0x00,0x00}}, //code[124]
+		{{0x00,0x80,0x00,0x00,0x00},{0x00,0x20,0x1B,0x04,0x00}}, //code[125]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x04,0x15,0x0E,0x04}}, //code[126]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x0E,0x15,0x04,0x04}}, //code[127]
+	},
+	{ //shift 2
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0xC0,0x00,0x00},{0x00,0x00,0x13,0x00,0x00}}, //code[33]
+		{{0x00,0xC0,0x00,0xC0,0x00},{0x00,0x01,0x00,0x01,0x00}}, //code[34]
+		{{0x00,0xC0,0x00,0xC0,0x00},{0x05,0x1F,0x05,0x1F,0x05}}, //code[35]
+		{{0x00,0x80,0xC0,0x80,0x80},{0x09,0x0A,0x1F,0x0A,0x04}}, //code[36]
+		{{0xC0,0xC0,0x00,0x00,0x80},{0x08,0x04,0x02,0x19,0x18}}, //code[37]
+		{{0x80,0x40,0x40,0x80,0x00},{0x0D,0x12,0x15,0x08,0x14}}, //code[38]
+		{{0x00,0x40,0xC0,0x00,0x00},{0x00,0x01,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0x00,0x80,0x40,0x00},{0x00,0x07,0x08,0x10,0x00}}, //code[40]
+		{{0x00,0x40,0x80,0x00,0x00},{0x00,0x10,0x08,0x07,0x00}}, //code[41]
+		{{0x00,0x00,0x80,0x00,0x00},{0x05,0x02,0x0F,0x02,0x05}}, //code[42]
+		{{0x00,0x00,0x80,0x00,0x00},{0x02,0x02,0x0F,0x02,0x02}}, //code[43]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x14,0x0C,0x00,0x00}}, //code[44]
+		{{0x00,0x00,0x00,0x00,0x00},{0x02,0x02,0x02,0x02,0x02}}, //code[45]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x18,0x18,0x00,0x00}}, //code[46]
+		{{0x00,0x00,0x00,0x00,0x80},{0x08,0x04,0x02,0x01,0x00}}, //code[47]
+		{{0x80,0x40,0x40,0x40,0x80},{0x1F,0x14,0x12,0x11,0x1F}}, //code[48]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x10,0x1F,0x10,0x00}}, //code[49]
+		{{0x80,0x40,0x40,0x40,0x80},{0x10,0x18,0x14,0x12,0x11}}, //code[50]
+		{{0x40,0x40,0x40,0xC0,0x40},{0x08,0x10,0x11,0x12,0x0C}}, //code[51]
+		{{0x00,0x00,0x80,0x80,0x00},{0x06,0x05,0x04,0x1F,0x04}}, //code[52]
+		{{0xC0,0x40,0x40,0x40,0x40},{0x09,0x11,0x11,0x11,0x0E}}, //code[53]
+		{{0x00,0x80,0x40,0x40,0x00},{0x0F,0x12,0x12,0x12,0x0C}}, //code[54]
+		{{0x40,0x40,0x40,0x40,0xC0},{0x00,0x1C,0x02,0x01,0x00}}, //code[55]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0D,0x12,0x12,0x12,0x0D}}, //code[56]
+		{{0x80,0x40,0x40,0x40,0x80},{0x01,0x12,0x12,0x0A,0x07}}, //code[57]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x0D,0x0D,0x00,0x00}}, //code[58]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x15,0x0D,0x00,0x00}}, //code[59]
+		{{0x00,0x00,0x80,0x40,0x00},{0x02,0x05,0x08,0x10,0x00}}, //code[60]
+		{{0x00,0x00,0x00,0x00,0x00},{0x05,0x05,0x05,0x05,0x05}}, //code[61]
+		{{0x00,0x40,0x80,0x00,0x00},{0x00,0x10,0x08,0x05,0x02}}, //code[62]
+		{{0x80,0x40,0x40,0x40,0x80},{0x00,0x00,0x14,0x02,0x01}}, //code[63]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0C,0x12,0x1E,0x10,0x0F}}, //code[64]
+		{{0x80,0x40,0x40,0x40,0x80},{0x1F,0x04,0x04,0x04,0x1F}}, //code[65]
+		{{0xC0,0x40,0x40,0x40,0x80},{0x1F,0x12,0x12,0x12,0x0D}}, //code[66]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0F,0x10,0x10,0x10,0x08}}, //code[67]
+		{{0xC0,0x40,0x40,0x80,0x00},{0x1F,0x10,0x10,0x08,0x07}}, //code[68]
+		{{0xC0,0x40,0x40,0x40,0x40},{0x1F,0x12,0x12,0x12,0x10}}, //code[69]
+		{{0xC0,0x40,0x40,0x40,0x40},{0x1F,0x02,0x02,0x02,0x00}}, //code[70]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0F,0x10,0x12,0x12,0x1E}}, //code[71]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x1F,0x02,0x02,0x02,0x1F}}, //code[72]
+		{{0x00,0x40,0xC0,0x40,0x00},{0x00,0x10,0x1F,0x10,0x00}}, //code[73]
+		{{0x00,0x00,0x40,0xC0,0x40},{0x08,0x10,0x10,0x1F,0x00}}, //code[74]
+		{{0xC0,0x00,0x00,0x80,0x40},{0x1F,0x02,0x05,0x08,0x10}}, //code[75]
+		{{0xC0,0x00,0x00,0x00,0x00},{0x1F,0x10,0x10,0x10,0x10}}, //code[76]
+		{{0xC0,0x80,0x00,0x80,0xC0},{0x1F,0x00,0x03,0x00,0x1F}}, //code[77]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x1F,0x01,0x02,0x04,0x1F}}, //code[78]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0F,0x10,0x10,0x10,0x0F}}, //code[79]
+		{{0xC0,0x40,0x40,0x40,0x80},{0x1F,0x02,0x02,0x02,0x01}}, //code[80]
+		{{0x80,0x40,0x40,0x40,0x80},{0x0F,0x10,0x14,0x08,0x17}}, //code[81]
+		{{0x80,0x40,0x40,0x40,0x80},{0x1F,0x02,0x06,0x0A,0x11}}, //code[82]
+		{{0x80,0x40,0x40,0x40,0x40},{0x11,0x12,0x12,0x12,0x0C}}, //code[83]
+		{{0x40,0x40,0xC0,0x40,0x40},{0x00,0x00,0x1F,0x00,0x00}}, //code[84]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x0F,0x10,0x10,0x10,0x0F}}, //code[85]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x07,0x08,0x10,0x08,0x07}}, //code[86]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x0F,0x10,0x0E,0x10,0x0F}}, //code[87]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x18,0x05,0x02,0x05,0x18}}, //code[88]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x01,0x02,0x1C,0x02,0x01}}, //code[89]
+		{{0x40,0x40,0x40,0x40,0xC0},{0x18,0x14,0x12,0x11,0x10}}, //code[90]
+		{{0x00,0x40,0x40,0xC0,0x00},{0x00,0x10,0x10,0x1F,0x00}}, //code[91]
+		{{0x40,0x80,0x00,0x80,0x40},{0x05,0x05,0x1F,0x05,0x05}}, //code[92]
+		{{0x00,0xC0,0x40,0x40,0x00},{0x00,0x1F,0x10,0x10,0x00}}, //code[93]
+		{{0x00,0x80,0x40,0x80,0x00},{0x01,0x00,0x00,0x00,0x01}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x10,0x10,0x10,0x10,0x10}}, //code[95]
+		{{0x00,0x40,0x80,0x00,0x00},{0x00,0x00,0x00,0x01,0x00}}, //code[96]
+		{{0x00,0x00,0x00,0x00,0x00},{0x08,0x15,0x15,0x15,0x1E}}, //code[97]
+		{{0xC0,0x00,0x00,0x00,0x00},{0x1F,0x12,0x11,0x11,0x0E}}, //code[98]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0E,0x11,0x11,0x11,0x08}}, //code[99]
+		{{0x00,0x00,0x00,0x00,0xC0},{0x0E,0x11,0x11,0x12,0x1F}}, //code[100]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0E,0x15,0x15,0x15,0x06}}, //code[101]
+		{{0x00,0x80,0x40,0x40,0x80},{0x02,0x1F,0x02,0x00,0x00}}, //code[102]
+		{{0x00,0x80,0x80,0x80,0x80},{0x03,0x14,0x14,0x14,0x0F}}, //code[103]
+		{{0xC0,0x00,0x00,0x00,0x00},{0x1F,0x02,0x01,0x01,0x1E}}, //code[104]
+		{{0x00,0x00,0x40,0x00,0x00},{0x00,0x11,0x1F,0x10,0x00}}, //code[105]
+		{{0x00,0x00,0x00,0x40,0x00},{0x08,0x10,0x11,0x0F,0x00}}, //code[106]
+		{{0xC0,0x00,0x00,0x00,0x00},{0x1F,0x04,0x0A,0x11,0x00}}, //code[107]
+		{{0x00,0x40,0xC0,0x00,0x00},{0x00,0x10,0x1F,0x10,0x00}}, //code[108]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1F,0x01,0x06,0x01,0x1E}}, //code[109]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1F,0x02,0x01,0x01,0x1E}}, //code[110]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0E,0x11,0x11,0x11,0x0E}}, //code[111]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1F,0x05,0x05,0x05,0x02}}, //code[112]
+		{{0x00,0x00,0x00,0x00,0x00},{0x02,0x05,0x05,0x06,0x1F}}, //code[113]
+		{{0x00,0x00,0x00,0x00,0x00},{0x1F,0x02,0x01,0x01,0x02}}, //code[114]
+		{{0x00,0x00,0x00,0x00,0x00},{0x12,0x15,0x15,0x15,0x08}}, //code[115]
+		{{0x00,0xC0,0x00,0x00,0x00},{0x01,0x0F,0x11,0x10,0x08}}, //code[116]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0F,0x10,0x10,0x08,0x1F}}, //code[117]
+		{{0x00,0x00,0x00,0x00,0x00},{0x07,0x08,0x10,0x08,0x07}}, //code[118]
+		{{0x00,0x00,0x00,0x00,0x00},{0x0F,0x10,0x0C,0x10,0x0F}}, //code[119]
+		{{0x00,0x00,0x00,0x00,0x00},{0x11,0x0A,0x04,0x0A,0x11}}, //code[120]
+		{{0x00,0x00,0x00,0x00,0x00},{0x03,0x14,0x14,0x14,0x0F}}, //code[121]
+		{{0x00,0x00,0x00,0x00,0x00},{0x11,0x19,0x15,0x13,0x11}}, //code[122]
+		{{0x00,0x00,0x80,0x40,0x00},{0x00,0x02,0x0D,0x10,0x00}}, //code[123]
+		{{0x00,0x00,0xC0,0x00,0x00},{0x00,0x00,0x1F,0x00,0x00}}, //code[124]
+		{{0x00,0x40,0x80,0x00,0x00},{0x00,0x10,0x0D,0x02,0x00}}, //code[125]
+		{{0x00,0x00,0x80,0x00,0x00},{0x02,0x02,0x0A,0x07,0x02}}, //code[126]
+		{{0x00,0x00,0x80,0x00,0x00},{0x02,0x07,0x0A,0x02,0x02}}, //code[127]
+	},
+	{ //shift 3
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0xE0,0x00,0x00},{0x00,0x00,0x09,0x00,0x00}}, //code[33]
+		{{0x00,0xE0,0x00,0xE0,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[34]
+		{{0x80,0xE0,0x80,0xE0,0x80},{0x02,0x0F,0x02,0x0F,0x02}}, //code[35]
+		{{0x80,0x40,0xE0,0x40,0x40},{0x04,0x05,0x0F,0x05,0x02}}, //code[36]
+		{{0x60,0x60,0x00,0x80,0x40},{0x04,0x02,0x01,0x0C,0x0C}}, //code[37]
+		{{0xC0,0x20,0xA0,0x40,0x00},{0x06,0x09,0x0A,0x04,0x0A}}, //code[38]
+		{{0x00,0xA0,0x60,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0x80,0x40,0x20,0x00},{0x00,0x03,0x04,0x08,0x00}}, //code[40]
+		{{0x00,0x20,0x40,0x80,0x00},{0x00,0x08,0x04,0x03,0x00}}, //code[41]
+		{{0x80,0x00,0xC0,0x00,0x80},{0x02,0x01,0x07,0x01,0x02}}, //code[42]
+		{{0x00,0x00,0xC0,0x00,0x00},{0x01,0x01,0x07,0x01,0x01}}, //code[43]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x0A,0x06,0x00,0x00}}, //code[44]
+		{{0x00,0x00,0x00,0x00,0x00},{0x01,0x01,0x01,0x01,0x01}}, //code[45]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x0C,0x0C,0x00,0x00}}, //code[46]
+		{{0x00,0x00,0x00,0x80,0x40},{0x04,0x02,0x01,0x00,0x00}}, //code[47]
+		{{0xC0,0x20,0x20,0xA0,0xC0},{0x0F,0x0A,0x09,0x08,0x0F}}, //code[48]
+		{{0x00,0x40,0xC0,0x00,0x00},{0x00,0x08,0x0F,0x08,0x00}}, //code[49]
+		{{0x40,0x20,0x20,0x20,0xC0},{0x08,0x0C,0x0A,0x09,0x08}}, //code[50]
+		{{0x20,0x20,0xA0,0x60,0x20},{0x04,0x08,0x08,0x09,0x06}}, //code[51]
+		{{0x00,0x80,0x40,0xC0,0x00},{0x03,0x02,0x02,0x0F,0x02}}, //code[52]
+		{{0xE0,0xA0,0xA0,0xA0,0x20},{0x04,0x08,0x08,0x08,0x07}}, //code[53]
+		{{0x80,0x40,0x20,0x20,0x00},{0x07,0x09,0x09,0x09,0x06}}, //code[54]
+		{{0x20,0x20,0x20,0xA0,0x60},{0x00,0x0E,0x01,0x00,0x00}}, //code[55]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x06,0x09,0x09,0x09,0x06}}, //code[56]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x00,0x09,0x09,0x05,0x03}}, //code[57]
+		{{0x00,0xC0,0xC0,0x00,0x00},{0x00,0x06,0x06,0x00,0x00}}, //code[58]
+		{{0x00,0xC0,0xC0,0x00,0x00},{0x00,0x0A,0x06,0x00,0x00}}, //code[59]
+		{{0x00,0x80,0x40,0x20,0x00},{0x01,0x02,0x04,0x08,0x00}}, //code[60]
+		{{0x80,0x80,0x80,0x80,0x80},{0x02,0x02,0x02,0x02,0x02}}, //code[61]
+		{{0x00,0x20,0x40,0x80,0x00},{0x00,0x08,0x04,0x02,0x01}}, //code[62]
+		{{0x40,0x20,0x20,0x20,0xC0},{0x00,0x00,0x0A,0x01,0x00}}, //code[63]
+		{{0x40,0x20,0x20,0x20,0xC0},{0x06,0x09,0x0F,0x08,0x07}}, //code[64]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x0F,0x02,0x02,0x02,0x0F}}, //code[65]
+		{{0xE0,0x20,0x20,0x20,0xC0},{0x0F,0x09,0x09,0x09,0x06}}, //code[66]
+		{{0xC0,0x20,0x20,0x20,0x40},{0x07,0x08,0x08,0x08,0x04}}, //code[67]
+		{{0xE0,0x20,0x20,0x40,0x80},{0x0F,0x08,0x08,0x04,0x03}}, //code[68]
+		{{0xE0,0x20,0x20,0x20,0x20},{0x0F,0x09,0x09,0x09,0x08}}, //code[69]
+		{{0xE0,0x20,0x20,0x20,0x20},{0x0F,0x01,0x01,0x01,0x00}}, //code[70]
+		{{0xC0,0x20,0x20,0x20,0x40},{0x07,0x08,0x09,0x09,0x0F}}, //code[71]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x0F,0x01,0x01,0x01,0x0F}}, //code[72]
+		{{0x00,0x20,0xE0,0x20,0x00},{0x00,0x08,0x0F,0x08,0x00}}, //code[73]
+		{{0x00,0x00,0x20,0xE0,0x20},{0x04,0x08,0x08,0x0F,0x00}}, //code[74]
+		{{0xE0,0x00,0x80,0x40,0x20},{0x0F,0x01,0x02,0x04,0x08}}, //code[75]
+		{{0xE0,0x00,0x00,0x00,0x00},{0x0F,0x08,0x08,0x08,0x08}}, //code[76]
+		{{0xE0,0x40,0x80,0x40,0xE0},{0x0F,0x00,0x01,0x00,0x0F}}, //code[77]
+		{{0xE0,0x80,0x00,0x00,0xE0},{0x0F,0x00,0x01,0x02,0x0F}}, //code[78]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x07,0x08,0x08,0x08,0x07}}, //code[79]
+		{{0xE0,0x20,0x20,0x20,0xC0},{0x0F,0x01,0x01,0x01,0x00}}, //code[80]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x07,0x08,0x0A,0x04,0x0B}}, //code[81]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x0F,0x01,0x03,0x05,0x08}}, //code[82]
+		{{0xC0,0x20,0x20,0x20,0x20},{0x08,0x09,0x09,0x09,0x06}}, //code[83]
+		{{0x20,0x20,0xE0,0x20,0x20},{0x00,0x00,0x0F,0x00,0x00}}, //code[84]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x07,0x08,0x08,0x08,0x07}}, //code[85]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x03,0x04,0x08,0x04,0x03}}, //code[86]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x07,0x08,0x07,0x08,0x07}}, //code[87]
+		{{0x60,0x80,0x00,0x80,0x60},{0x0C,0x02,0x01,0x02,0x0C}}, //code[88]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x00,0x01,0x0E,0x01,0x00}}, //code[89]
+		{{0x20,0x20,0x20,0xA0,0x60},{0x0C,0x0A,0x09,0x08,0x08}}, //code[90]
+		{{0x00,0x20,0x20,0xE0,0x00},{0x00,0x08,0x08,0x0F,0x00}}, //code[91]
+		{{0xA0,0xC0,0x80,0xC0,0xA0},{0x02,0x02,0x0F,0x02,0x02}}, //code[92]
+		{{0x00,0xE0,0x20,0x20,0x00},{0x00,0x0F,0x08,0x08,0x00}}, //code[93]
+		{{0x80,0x40,0x20,0x40,0x80},{0x00,0x00,0x00,0x00,0x00}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x08,0x08,0x08,0x08,0x08}}, //code[95]
+		{{0x00,0x20,0x40,0x80,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[96]
+		{{0x00,0x80,0x80,0x80,0x00},{0x04,0x0A,0x0A,0x0A,0x0F}}, //code[97]
+		{{0xE0,0x00,0x80,0x80,0x00},{0x0F,0x09,0x08,0x08,0x07}}, //code[98]
+		{{0x00,0x80,0x80,0x80,0x00},{0x07,0x08,0x08,0x08,0x04}}, //code[99]
+		{{0x00,0x80,0x80,0x00,0xE0},{0x07,0x08,0x08,0x09,0x0F}}, //code[100]
+		{{0x00,0x80,0x80,0x80,0x00},{0x07,0x0A,0x0A,0x0A,0x03}}, //code[101]
+		{{0x00,0xC0,0x20,0x20,0x40},{0x01,0x0F,0x01,0x00,0x00}}, //code[102]
+		{{0x80,0x40,0x40,0x40,0xC0},{0x01,0x0A,0x0A,0x0A,0x07}}, //code[103]
+		{{0xE0,0x00,0x80,0x80,0x00},{0x0F,0x01,0x00,0x00,0x0F}}, //code[104]
+		{{0x00,0x80,0xA0,0x00,0x00},{0x00,0x08,0x0F,0x08,0x00}}, //code[105]
+		{{0x00,0x00,0x80,0xA0,0x00},{0x04,0x08,0x08,0x07,0x00}}, //code[106]
+		{{0xE0,0x00,0x00,0x80,0x00},{0x0F,0x02,0x05,0x08,0x00}}, //code[107]
+		{{0x00,0x20,0xE0,0x00,0x00},{0x00,0x08,0x0F,0x08,0x00}}, //code[108]
+		{{0x80,0x80,0x00,0x80,0x00},{0x0F,0x00,0x03,0x00,0x0F}}, //code[109]
+		{{0x80,0x00,0x80,0x80,0x00},{0x0F,0x01,0x00,0x00,0x0F}}, //code[110]
+		{{0x00,0x80,0x80,0x80,0x00},{0x07,0x08,0x08,0x08,0x07}}, //code[111]
+		{{0x80,0x80,0x80,0x80,0x00},{0x0F,0x02,0x02,0x02,0x01}}, //code[112]
+		{{0x00,0x80,0x80,0x00,0x80},{0x01,0x02,0x02,0x03,0x0F}}, //code[113]
+		{{0x80,0x00,0x80,0x80,0x00},{0x0F,0x01,0x00,0x00,0x01}}, //code[114]
+		{{0x00,0x80,0x80,0x80,0x00},{0x09,0x0A,0x0A,0x0A,0x04}}, //code[115]
+		{{0x80,0xE0,0x80,0x00,0x00},{0x00,0x07,0x08,0x08,0x04}}, //code[116]
+		{{0x80,0x00,0x00,0x00,0x80},{0x07,0x08,0x08,0x04,0x0F}}, //code[117]
+		{{0x80,0x00,0x00,0x00,0x80},{0x03,0x04,0x08,0x04,0x03}}, //code[118]
+		{{0x80,0x00,0x00,0x00,0x80},{0x07,0x08,0x06,0x08,0x07}}, //code[119]
+		{{0x80,0x00,0x00,0x00,0x80},{0x08,0x05,0x02,0x05,0x08}}, //code[120]
+		{{0x80,0x00,0x00,0x00,0x80},{0x01,0x0A,0x0A,0x0A,0x07}}, //code[121]
+		{{0x80,0x80,0x80,0x80,0x80},{0x08,0x0C,0x0A,0x09,0x08}}, //code[122]
+		{{0x00,0x00,0xC0,0x20,0x00},{0x00,0x01,0x06,0x08,0x00}}, //code[123]
+		{{0x00,0x00,0xE0,0x00,0x00},{0x00,0x00,0x0F,0x00,0x00}}, //code[124]
+		{{0x00,0x20,0xC0,0x00,0x00},{0x00,0x08,0x06,0x01,0x00}}, //code[125]
+		{{0x00,0x00,0x40,0x80,0x00},{0x01,0x01,0x05,0x03,0x01}}, //code[126]
+		{{0x00,0x80,0x40,0x00,0x00},{0x01,0x03,0x05,0x01,0x01}}, //code[127]
+	},
+	{ //shift 4
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0xF0,0x00,0x00},{0x00,0x00,0x04,0x00,0x00}}, //code[33]
+		{{0x00,0x70,0x00,0x70,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[34]
+		{{0x40,0xF0,0x40,0xF0,0x40},{0x01,0x07,0x01,0x07,0x01}}, //code[35]
+		{{0x40,0xA0,0xF0,0xA0,0x20},{0x02,0x02,0x07,0x02,0x01}}, //code[36]
+		{{0x30,0x30,0x80,0x40,0x20},{0x02,0x01,0x00,0x06,0x06}}, //code[37]
+		{{0x60,0x90,0x50,0x20,0x00},{0x03,0x04,0x05,0x02,0x05}}, //code[38]
+		{{0x00,0x50,0x30,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0xC0,0x20,0x10,0x00},{0x00,0x01,0x02,0x04,0x00}}, //code[40]
+		{{0x00,0x10,0x20,0xC0,0x00},{0x00,0x04,0x02,0x01,0x00}}, //code[41]
+		{{0x40,0x80,0xE0,0x80,0x40},{0x01,0x00,0x03,0x00,0x01}}, //code[42]
+		{{0x80,0x80,0xE0,0x80,0x80},{0x00,0x00,0x03,0x00,0x00}}, //code[43]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x05,0x03,0x00,0x00}}, //code[44]
+		{{0x80,0x80,0x80,0x80,0x80},{0x00,0x00,0x00,0x00,0x00}}, //code[45]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x06,0x06,0x00,0x00}}, //code[46]
+		{{0x00,0x00,0x80,0x40,0x20},{0x02,0x01,0x00,0x00,0x00}}, //code[47]
+		{{0xE0,0x10,0x90,0x50,0xE0},{0x07,0x05,0x04,0x04,0x07}}, //code[48]
+		{{0x00,0x20,0xE0,0x00,0x00},{0x00,0x04,0x07,0x04,0x00}}, //code[49]
+		{{0x20,0x10,0x10,0x90,0x60},{0x04,0x06,0x05,0x04,0x04}}, //code[50]
+		{{0x10,0x10,0x50,0xB0,0x10},{0x02,0x04,0x04,0x04,0x03}}, //code[51]
+		{{0x80,0x40,0x20,0xE0,0x00},{0x01,0x01,0x01,0x07,0x01}}, //code[52]
+		{{0x70,0x50,0x50,0x50,0x90},{0x02,0x04,0x04,0x04,0x03}}, //code[53]
+		{{0xC0,0xA0,0x90,0x90,0x00},{0x03,0x04,0x04,0x04,0x03}}, //code[54]
+		{{0x10,0x10,0x90,0x50,0x30},{0x00,0x07,0x00,0x00,0x00}}, //code[55]
+		{{0x60,0x90,0x90,0x90,0x60},{0x03,0x04,0x04,0x04,0x03}}, //code[56]
+		{{0x60,0x90,0x90,0x90,0xE0},{0x00,0x04,0x04,0x02,0x01}}, //code[57]
+		{{0x00,0x60,0x60,0x00,0x00},{0x00,0x03,0x03,0x00,0x00}}, //code[58]
+		{{0x00,0x60,0x60,0x00,0x00},{0x00,0x05,0x03,0x00,0x00}}, //code[59]
+		{{0x80,0x40,0x20,0x10,0x00},{0x00,0x01,0x02,0x04,0x00}}, //code[60]
+		{{0x40,0x40,0x40,0x40,0x40},{0x01,0x01,0x01,0x01,0x01}}, //code[61]
+		{{0x00,0x10,0x20,0x40,0x80},{0x00,0x04,0x02,0x01,0x00}}, //code[62]
+		{{0x20,0x10,0x10,0x90,0x60},{0x00,0x00,0x05,0x00,0x00}}, //code[63]
+		{{0x20,0x90,0x90,0x10,0xE0},{0x03,0x04,0x07,0x04,0x03}}, //code[64]
+		{{0xE0,0x10,0x10,0x10,0xE0},{0x07,0x01,0x01,0x01,0x07}}, //code[65]
+		{{0xF0,0x90,0x90,0x90,0x60},{0x07,0x04,0x04,0x04,0x03}}, //code[66]
+		{{0xE0,0x10,0x10,0x10,0x20},{0x03,0x04,0x04,0x04,0x02}}, //code[67]
+		{{0xF0,0x10,0x10,0x20,0xC0},{0x07,0x04,0x04,0x02,0x01}}, //code[68]
+		{{0xF0,0x90,0x90,0x90,0x10},{0x07,0x04,0x04,0x04,0x04}}, //code[69]
+		{{0xF0,0x90,0x90,0x90,0x10},{0x07,0x00,0x00,0x00,0x00}}, //code[70]
+		{{0xE0,0x10,0x90,0x90,0xA0},{0x03,0x04,0x04,0x04,0x07}}, //code[71]
+		{{0xF0,0x80,0x80,0x80,0xF0},{0x07,0x00,0x00,0x00,0x07}}, //code[72]
+		{{0x00,0x10,0xF0,0x10,0x00},{0x00,0x04,0x07,0x04,0x00}}, //code[73]
+		{{0x00,0x00,0x10,0xF0,0x10},{0x02,0x04,0x04,0x07,0x00}}, //code[74]
+		{{0xF0,0x80,0x40,0x20,0x10},{0x07,0x00,0x01,0x02,0x04}}, //code[75]
+		{{0xF0,0x00,0x00,0x00,0x00},{0x07,0x04,0x04,0x04,0x04}}, //code[76]
+		{{0xF0,0x20,0xC0,0x20,0xF0},{0x07,0x00,0x00,0x00,0x07}}, //code[77]
+		{{0xF0,0x40,0x80,0x00,0xF0},{0x07,0x00,0x00,0x01,0x07}}, //code[78]
+		{{0xE0,0x10,0x10,0x10,0xE0},{0x03,0x04,0x04,0x04,0x03}}, //code[79]
+		{{0xF0,0x90,0x90,0x90,0x60},{0x07,0x00,0x00,0x00,0x00}}, //code[80]
+		{{0xE0,0x10,0x10,0x10,0xE0},{0x03,0x04,0x05,0x02,0x05}}, //code[81]
+		{{0xE0,0x90,0x90,0x90,0x60},{0x07,0x00,0x01,0x02,0x04}}, //code[82]
+		{{0x60,0x90,0x90,0x90,0x10},{0x04,0x04,0x04,0x04,0x03}}, //code[83]
+		{{0x10,0x10,0xF0,0x10,0x10},{0x00,0x00,0x07,0x00,0x00}}, //code[84]
+		{{0xF0,0x00,0x00,0x00,0xF0},{0x03,0x04,0x04,0x04,0x03}}, //code[85]
+		{{0xF0,0x00,0x00,0x00,0xF0},{0x01,0x02,0x04,0x02,0x01}}, //code[86]
+		{{0xF0,0x00,0x80,0x00,0xF0},{0x03,0x04,0x03,0x04,0x03}}, //code[87]
+		{{0x30,0x40,0x80,0x40,0x30},{0x06,0x01,0x00,0x01,0x06}}, //code[88]
+		{{0x70,0x80,0x00,0x80,0x70},{0x00,0x00,0x07,0x00,0x00}}, //code[89]
+		{{0x10,0x10,0x90,0x50,0x30},{0x06,0x05,0x04,0x04,0x04}}, //code[90]
+		{{0x00,0x10,0x10,0xF0,0x00},{0x00,0x04,0x04,0x07,0x00}}, //code[91]
+		{{0x50,0x60,0xC0,0x60,0x50},{0x01,0x01,0x07,0x01,0x01}}, //code[92]
+		{{0x00,0xF0,0x10,0x10,0x00},{0x00,0x07,0x04,0x04,0x00}}, //code[93]
+		{{0x40,0x20,0x10,0x20,0x40},{0x00,0x00,0x00,0x00,0x00}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x04,0x04,0x04,0x04,0x04}}, //code[95]
+		{{0x00,0x10,0x20,0x40,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[96]
+		{{0x00,0x40,0x40,0x40,0x80},{0x02,0x05,0x05,0x05,0x07}}, //code[97]
+		{{0xF0,0x80,0x40,0x40,0x80},{0x07,0x04,0x04,0x04,0x03}}, //code[98]
+		{{0x80,0x40,0x40,0x40,0x00},{0x03,0x04,0x04,0x04,0x02}}, //code[99]
+		{{0x80,0x40,0x40,0x80,0xF0},{0x03,0x04,0x04,0x04,0x07}}, //code[100]
+		{{0x80,0x40,0x40,0x40,0x80},{0x03,0x05,0x05,0x05,0x01}}, //code[101]
+		{{0x80,0xE0,0x90,0x10,0x20},{0x00,0x07,0x00,0x00,0x00}}, //code[102]
+		{{0xC0,0x20,0x20,0x20,0xE0},{0x00,0x05,0x05,0x05,0x03}}, //code[103]
+		{{0xF0,0x80,0x40,0x40,0x80},{0x07,0x00,0x00,0x00,0x07}}, //code[104]
+		{{0x00,0x40,0xD0,0x00,0x00},{0x00,0x04,0x07,0x04,0x00}}, //code[105]
+		{{0x00,0x00,0x40,0xD0,0x00},{0x02,0x04,0x04,0x03,0x00}}, //code[106]
+		{{0xF0,0x00,0x80,0x40,0x00},{0x07,0x01,0x02,0x04,0x00}}, //code[107]
+		{{0x00,0x10,0xF0,0x00,0x00},{0x00,0x04,0x07,0x04,0x00}}, //code[108]
+		{{0xC0,0x40,0x80,0x40,0x80},{0x07,0x00,0x01,0x00,0x07}}, //code[109]
+		{{0xC0,0x80,0x40,0x40,0x80},{0x07,0x00,0x00,0x00,0x07}}, //code[110]
+		{{0x80,0x40,0x40,0x40,0x80},{0x03,0x04,0x04,0x04,0x03}}, //code[111]
+		{{0xC0,0x40,0x40,0x40,0x80},{0x07,0x01,0x01,0x01,0x00}}, //code[112]
+		{{0x80,0x40,0x40,0x80,0xC0},{0x00,0x01,0x01,0x01,0x07}}, //code[113]
+		{{0xC0,0x80,0x40,0x40,0x80},{0x07,0x00,0x00,0x00,0x00}}, //code[114]
+		{{0x80,0x40,0x40,0x40,0x00},{0x04,0x05,0x05,0x05,0x02}}, //code[115]
+		{{0x40,0xF0,0x40,0x00,0x00},{0x00,0x03,0x04,0x04,0x02}}, //code[116]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x03,0x04,0x04,0x02,0x07}}, //code[117]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x01,0x02,0x04,0x02,0x01}}, //code[118]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x03,0x04,0x03,0x04,0x03}}, //code[119]
+		{{0x40,0x80,0x00,0x80,0x40},{0x04,0x02,0x01,0x02,0x04}}, //code[120]
+		{{0xC0,0x00,0x00,0x00,0xC0},{0x00,0x05,0x05,0x05,0x03}}, //code[121]
+		{{0x40,0x40,0x40,0xC0,0x40},{0x04,0x06,0x05,0x04,0x04}}, //code[122]
+		{{0x00,0x80,0x60,0x10,0x00},{0x00,0x00,0x03,0x04,0x00}}, //code[123]
+		{{0x00,0x00,0xF0,0x00,0x00},{0x00,0x00,0x07,0x00,0x00}}, //code[124]
+		{{0x00,0x10,0x60,0x80,0x00},{0x00,0x04,0x03,0x00,0x00}}, //code[125]
+		{{0x80,0x80,0xA0,0xC0,0x80},{0x00,0x00,0x02,0x01,0x00}}, //code[126]
+		{{0x80,0xC0,0xA0,0x80,0x80},{0x00,0x01,0x02,0x00,0x00}}, //code[127]
+	},
+	{ //shift 5
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0x78,0x00,0x00},{0x00,0x00,0x02,0x00,0x00}}, //code[33]
+		{{0x00,0x38,0x00,0x38,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[34]
+		{{0xA0,0xF8,0xA0,0xF8,0xA0},{0x00,0x03,0x00,0x03,0x00}}, //code[35]
+		{{0x20,0x50,0xF8,0x50,0x90},{0x01,0x01,0x03,0x01,0x00}}, //code[36]
+		{{0x18,0x98,0x40,0x20,0x10},{0x01,0x00,0x00,0x03,0x03}}, //code[37]
+		{{0xB0,0x48,0xA8,0x10,0x80},{0x01,0x02,0x02,0x01,0x02}}, //code[38]
+		{{0x00,0x28,0x18,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0xE0,0x10,0x08,0x00},{0x00,0x00,0x01,0x02,0x00}}, //code[40]
+		{{0x00,0x08,0x10,0xE0,0x00},{0x00,0x02,0x01,0x00,0x00}}, //code[41]
+		{{0xA0,0x40,0xF0,0x40,0xA0},{0x00,0x00,0x01,0x00,0x00}}, //code[42]
+		{{0x40,0x40,0xF0,0x40,0x40},{0x00,0x00,0x01,0x00,0x00}}, //code[43]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x02,0x01,0x00,0x00}}, //code[44]
+		{{0x40,0x40,0x40,0x40,0x40},{0x00,0x00,0x00,0x00,0x00}}, //code[45]
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x03,0x03,0x00,0x00}}, //code[46]
+		{{0x00,0x80,0x40,0x20,0x10},{0x01,0x00,0x00,0x00,0x00}}, //code[47]
+		{{0xF0,0x88,0x48,0x28,0xF0},{0x03,0x02,0x02,0x02,0x03}}, //code[48]
+		{{0x00,0x10,0xF0,0x00,0x00},{0x00,0x02,0x03,0x02,0x00}}, //code[49]
+		{{0x10,0x08,0x88,0x48,0x30},{0x02,0x03,0x02,0x02,0x02}}, //code[50]
+		{{0x08,0x08,0x28,0x58,0x88},{0x01,0x02,0x02,0x02,0x01}}, //code[51]
+		{{0xC0,0xA0,0x90,0xF0,0x80},{0x00,0x00,0x00,0x03,0x00}}, //code[52]
+		{{0x38,0x28,0x28,0x28,0xC8},{0x01,0x02,0x02,0x02,0x01}}, //code[53]
+		{{0xE0,0x50,0x48,0x48,0x80},{0x01,0x02,0x02,0x02,0x01}}, //code[54]
+		{{0x08,0x88,0x48,0x28,0x18},{0x00,0x03,0x00,0x00,0x00}}, //code[55]
+		{{0xB0,0x48,0x48,0x48,0xB0},{0x01,0x02,0x02,0x02,0x01}}, //code[56]
+		{{0x30,0x48,0x48,0x48,0xF0},{0x00,0x02,0x02,0x01,0x00}}, //code[57]
+		{{0x00,0xB0,0xB0,0x00,0x00},{0x00,0x01,0x01,0x00,0x00}}, //code[58]
+		{{0x00,0xB0,0xB0,0x00,0x00},{0x00,0x02,0x01,0x00,0x00}}, //code[59]
+		{{0x40,0xA0,0x10,0x08,0x00},{0x00,0x00,0x01,0x02,0x00}}, //code[60]
+		{{0xA0,0xA0,0xA0,0xA0,0xA0},{0x00,0x00,0x00,0x00,0x00}}, //code[61]
+		{{0x00,0x08,0x10,0xA0,0x40},{0x00,0x02,0x01,0x00,0x00}}, //code[62]
+		{{0x10,0x08,0x88,0x48,0x30},{0x00,0x00,0x02,0x00,0x00}}, //code[63]
+		{{0x90,0x48,0xC8,0x08,0xF0},{0x01,0x02,0x03,0x02,0x01}}, //code[64]
+		{{0xF0,0x88,0x88,0x88,0xF0},{0x03,0x00,0x00,0x00,0x03}}, //code[65]
+		{{0xF8,0x48,0x48,0x48,0xB0},{0x03,0x02,0x02,0x02,0x01}}, //code[66]
+		{{0xF0,0x08,0x08,0x08,0x10},{0x01,0x02,0x02,0x02,0x01}}, //code[67]
+		{{0xF8,0x08,0x08,0x10,0xE0},{0x03,0x02,0x02,0x01,0x00}}, //code[68]
+		{{0xF8,0x48,0x48,0x48,0x08},{0x03,0x02,0x02,0x02,0x02}}, //code[69]
+		{{0xF8,0x48,0x48,0x48,0x08},{0x03,0x00,0x00,0x00,0x00}}, //code[70]
+		{{0xF0,0x08,0x48,0x48,0xD0},{0x01,0x02,0x02,0x02,0x03}}, //code[71]
+		{{0xF8,0x40,0x40,0x40,0xF8},{0x03,0x00,0x00,0x00,0x03}}, //code[72]
+		{{0x00,0x08,0xF8,0x08,0x00},{0x00,0x02,0x03,0x02,0x00}}, //code[73]
+		{{0x00,0x00,0x08,0xF8,0x08},{0x01,0x02,0x02,0x03,0x00}}, //code[74]
+		{{0xF8,0x40,0xA0,0x10,0x08},{0x03,0x00,0x00,0x01,0x02}}, //code[75]
+		{{0xF8,0x00,0x00,0x00,0x00},{0x03,0x02,0x02,0x02,0x02}}, //code[76]
+		{{0xF8,0x10,0x60,0x10,0xF8},{0x03,0x00,0x00,0x00,0x03}}, //code[77]
+		{{0xF8,0x20,0x40,0x80,0xF8},{0x03,0x00,0x00,0x00,0x03}}, //code[78]
+		{{0xF0,0x08,0x08,0x08,0xF0},{0x01,0x02,0x02,0x02,0x01}}, //code[79]
+		{{0xF8,0x48,0x48,0x48,0x30},{0x03,0x00,0x00,0x00,0x00}}, //code[80]
+		{{0xF0,0x08,0x88,0x08,0xF0},{0x01,0x02,0x02,0x01,0x02}}, //code[81]
+		{{0xF0,0x48,0xC8,0x48,0x30},{0x03,0x00,0x00,0x01,0x02}}, //code[82]
+		{{0x30,0x48,0x48,0x48,0x88},{0x02,0x02,0x02,0x02,0x01}}, //code[83]
+		{{0x08,0x08,0xF8,0x08,0x08},{0x00,0x00,0x03,0x00,0x00}}, //code[84]
+		{{0xF8,0x00,0x00,0x00,0xF8},{0x01,0x02,0x02,0x02,0x01}}, //code[85]
+		{{0xF8,0x00,0x00,0x00,0xF8},{0x00,0x01,0x02,0x01,0x00}}, //code[86]
+		{{0xF8,0x00,0xC0,0x00,0xF8},{0x01,0x02,0x01,0x02,0x01}}, //code[87]
+		{{0x18,0xA0,0x40,0xA0,0x18},{0x03,0x00,0x00,0x00,0x03}}, //code[88]
+		{{0x38,0x40,0x80,0x40,0x38},{0x00,0x00,0x03,0x00,0x00}}, //code[89]
+		{{0x08,0x88,0x48,0x28,0x18},{0x03,0x02,0x02,0x02,0x02}}, //code[90]
+		{{0x00,0x08,0x08,0xF8,0x00},{0x00,0x02,0x02,0x03,0x00}}, //code[91]
+		{{0xA8,0xB0,0xE0,0xB0,0xA8},{0x00,0x00,0x03,0x00,0x00}}, //code[92]
+		{{0x00,0xF8,0x08,0x08,0x00},{0x00,0x03,0x02,0x02,0x00}}, //code[93]
+		{{0x20,0x10,0x08,0x10,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x02,0x02,0x02,0x02,0x02}}, //code[95]
+		{{0x00,0x08,0x10,0x20,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[96]
+		{{0x00,0xA0,0xA0,0xA0,0xC0},{0x01,0x02,0x02,0x02,0x03}}, //code[97]
+		{{0xF8,0x40,0x20,0x20,0xC0},{0x03,0x02,0x02,0x02,0x01}}, //code[98]
+		{{0xC0,0x20,0x20,0x20,0x00},{0x01,0x02,0x02,0x02,0x01}}, //code[99]
+		{{0xC0,0x20,0x20,0x40,0xF8},{0x01,0x02,0x02,0x02,0x03}}, //code[100]
+		{{0xC0,0xA0,0xA0,0xA0,0xC0},{0x01,0x02,0x02,0x02,0x00}}, //code[101]
+		{{0x40,0xF0,0x48,0x08,0x10},{0x00,0x03,0x00,0x00,0x00}}, //code[102]
+		{{0x60,0x90,0x90,0x90,0xF0},{0x00,0x02,0x02,0x02,0x01}}, //code[103]
+		{{0xF8,0x40,0x20,0x20,0xC0},{0x03,0x00,0x00,0x00,0x03}}, //code[104]
+		{{0x00,0x20,0xE8,0x00,0x00},{0x00,0x02,0x03,0x02,0x00}}, //code[105]
+		{{0x00,0x00,0x20,0xE8,0x00},{0x01,0x02,0x02,0x01,0x00}}, //code[106]
+		{{0xF8,0x80,0x40,0x20,0x00},{0x03,0x00,0x01,0x02,0x00}}, //code[107]
+		{{0x00,0x08,0xF8,0x00,0x00},{0x00,0x02,0x03,0x02,0x00}}, //code[108]
+		{{0xE0,0x20,0xC0,0x20,0xC0},{0x03,0x00,0x00,0x00,0x03}}, //code[109]
+		{{0xE0,0x40,0x20,0x20,0xC0},{0x03,0x00,0x00,0x00,0x03}}, //code[110]
+		{{0xC0,0x20,0x20,0x20,0xC0},{0x01,0x02,0x02,0x02,0x01}}, //code[111]
+		{{0xE0,0xA0,0xA0,0xA0,0x40},{0x03,0x00,0x00,0x00,0x00}}, //code[112]
+		{{0x40,0xA0,0xA0,0xC0,0xE0},{0x00,0x00,0x00,0x00,0x03}}, //code[113]
+		{{0xE0,0x40,0x20,0x20,0x40},{0x03,0x00,0x00,0x00,0x00}}, //code[114]
+		{{0x40,0xA0,0xA0,0xA0,0x00},{0x02,0x02,0x02,0x02,0x01}}, //code[115]
+		{{0x20,0xF8,0x20,0x00,0x00},{0x00,0x01,0x02,0x02,0x01}}, //code[116]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x01,0x02,0x02,0x01,0x03}}, //code[117]
+		{{0xE0,0x00,0x00,0x00,0xE0},{0x00,0x01,0x02,0x01,0x00}}, //code[118]
+		{{0xE0,0x00,0x80,0x00,0xE0},{0x01,0x02,0x01,0x02,0x01}}, //code[119]
+		{{0x20,0x40,0x80,0x40,0x20},{0x02,0x01,0x00,0x01,0x02}}, //code[120]
+		{{0x60,0x80,0x80,0x80,0xE0},{0x00,0x02,0x02,0x02,0x01}}, //code[121]
+		{{0x20,0x20,0xA0,0x60,0x20},{0x02,0x03,0x02,0x02,0x02}}, //code[122]
+		{{0x00,0x40,0xB0,0x08,0x00},{0x00,0x00,0x01,0x02,0x00}}, //code[123]
+		{{0x00,0x00,0xF8,0x00,0x00},{0x00,0x00,0x03,0x00,0x00}}, //code[124]
+		{{0x00,0x08,0xB0,0x40,0x00},{0x00,0x02,0x01,0x00,0x00}}, //code[125]
+		{{0x40,0x40,0x50,0xE0,0x40},{0x00,0x00,0x01,0x00,0x00}}, //code[126]
+		{{0x40,0xE0,0x50,0x40,0x40},{0x00,0x00,0x01,0x00,0x00}}, //code[127]
+	},
+	{ //shift 6
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0x3C,0x00,0x00},{0x00,0x00,0x01,0x00,0x00}}, //code[33]
+		{{0x00,0x1C,0x00,0x1C,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[34]
+		{{0x50,0xFC,0x50,0xFC,0x50},{0x00,0x01,0x00,0x01,0x00}}, //code[35]
+		{{0x90,0xA8,0xFC,0xA8,0x48},{0x00,0x00,0x01,0x00,0x00}}, //code[36]
+		{{0x8C,0x4C,0x20,0x90,0x88},{0x00,0x00,0x00,0x01,0x01}}, //code[37]
+		{{0xD8,0x24,0x54,0x88,0x40},{0x00,0x01,0x01,0x00,0x01}}, //code[38]
+		{{0x00,0x14,0x0C,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0x70,0x88,0x04,0x00},{0x00,0x00,0x00,0x01,0x00}}, //code[40]
+		{{0x00,0x04,0x88,0x70,0x00},{0x00,0x01,0x00,0x00,0x00}}, //code[41]
+		{{0x50,0x20,0xF8,0x20,0x50},{0x00,0x00,0x00,0x00,0x00}}, //code[42]
+		{{0x20,0x20,0xF8,0x20,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[43]
+		{{0x00,0x40,0xC0,0x00,0x00},{0x00,0x01,0x00,0x00,0x00}}, //code[44]
+		{{0x20,0x20,0x20,0x20,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[45]
+		{{0x00,0x80,0x80,0x00,0x00},{0x00,0x01,0x01,0x00,0x00}}, //code[46]
+		{{0x80,0x40,0x20,0x10,0x08},{0x00,0x00,0x00,0x00,0x00}}, //code[47]
+		{{0xF8,0x44,0x24,0x14,0xF8},{0x01,0x01,0x01,0x01,0x01}}, //code[48]
+		{{0x00,0x08,0xF8,0x00,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[49]
+		{{0x08,0x84,0x44,0x24,0x18},{0x01,0x01,0x01,0x01,0x01}}, //code[50]
+		{{0x84,0x04,0x14,0x2C,0xC4},{0x00,0x01,0x01,0x01,0x00}}, //code[51]
+		{{0x60,0x50,0x48,0xF8,0x40},{0x00,0x00,0x00,0x01,0x00}}, //code[52]
+		{{0x9C,0x14,0x14,0x14,0xE4},{0x00,0x01,0x01,0x01,0x00}}, //code[53]
+		{{0xF0,0x28,0x24,0x24,0xC0},{0x00,0x01,0x01,0x01,0x00}}, //code[54]
+		{{0x04,0xC4,0x24,0x14,0x0C},{0x00,0x01,0x00,0x00,0x00}}, //code[55]
+		{{0xD8,0x24,0x24,0x24,0xD8},{0x00,0x01,0x01,0x01,0x00}}, //code[56]
+		{{0x18,0x24,0x24,0xA4,0x78},{0x00,0x01,0x01,0x00,0x00}}, //code[57]
+		{{0x00,0xD8,0xD8,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[58]
+		{{0x00,0x58,0xD8,0x00,0x00},{0x00,0x01,0x00,0x00,0x00}}, //code[59]
+		{{0x20,0x50,0x88,0x04,0x00},{0x00,0x00,0x00,0x01,0x00}}, //code[60]
+		{{0x50,0x50,0x50,0x50,0x50},{0x00,0x00,0x00,0x00,0x00}}, //code[61]
+		{{0x00,0x04,0x88,0x50,0x20},{0x00,0x01,0x00,0x00,0x00}}, //code[62]
+		{{0x08,0x04,0x44,0x24,0x18},{0x00,0x00,0x01,0x00,0x00}}, //code[63]
+		{{0xC8,0x24,0xE4,0x04,0xF8},{0x00,0x01,0x01,0x01,0x00}}, //code[64]
+		{{0xF8,0x44,0x44,0x44,0xF8},{0x01,0x00,0x00,0x00,0x01}}, //code[65]
+		{{0xFC,0x24,0x24,0x24,0xD8},{0x01,0x01,0x01,0x01,0x00}}, //code[66]
+		{{0xF8,0x04,0x04,0x04,0x88},{0x00,0x01,0x01,0x01,0x00}}, //code[67]
+		{{0xFC,0x04,0x04,0x88,0x70},{0x01,0x01,0x01,0x00,0x00}}, //code[68]
+		{{0xFC,0x24,0x24,0x24,0x04},{0x01,0x01,0x01,0x01,0x01}}, //code[69]
+		{{0xFC,0x24,0x24,0x24,0x04},{0x01,0x00,0x00,0x00,0x00}}, //code[70]
+		{{0xF8,0x04,0x24,0x24,0xE8},{0x00,0x01,0x01,0x01,0x01}}, //code[71]
+		{{0xFC,0x20,0x20,0x20,0xFC},{0x01,0x00,0x00,0x00,0x01}}, //code[72]
+		{{0x00,0x04,0xFC,0x04,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[73]
+		{{0x80,0x00,0x04,0xFC,0x04},{0x00,0x01,0x01,0x01,0x00}}, //code[74]
+		{{0xFC,0x20,0x50,0x88,0x04},{0x01,0x00,0x00,0x00,0x01}}, //code[75]
+		{{0xFC,0x00,0x00,0x00,0x00},{0x01,0x01,0x01,0x01,0x01}}, //code[76]
+		{{0xFC,0x08,0x30,0x08,0xFC},{0x01,0x00,0x00,0x00,0x01}}, //code[77]
+		{{0xFC,0x10,0x20,0x40,0xFC},{0x01,0x00,0x00,0x00,0x01}}, //code[78]
+		{{0xF8,0x04,0x04,0x04,0xF8},{0x00,0x01,0x01,0x01,0x00}}, //code[79]
+		{{0xFC,0x24,0x24,0x24,0x18},{0x01,0x00,0x00,0x00,0x00}}, //code[80]
+		{{0xF8,0x04,0x44,0x84,0x78},{0x00,0x01,0x01,0x00,0x01}}, //code[81]
+		{{0xF8,0x24,0x64,0xA4,0x18},{0x01,0x00,0x00,0x00,0x01}}, //code[82]
+		{{0x18,0x24,0x24,0x24,0xC4},{0x01,0x01,0x01,0x01,0x00}}, //code[83]
+		{{0x04,0x04,0xFC,0x04,0x04},{0x00,0x00,0x01,0x00,0x00}}, //code[84]
+		{{0xFC,0x00,0x00,0x00,0xFC},{0x00,0x01,0x01,0x01,0x00}}, //code[85]
+		{{0x7C,0x80,0x00,0x80,0x7C},{0x00,0x00,0x01,0x00,0x00}}, //code[86]
+		{{0xFC,0x00,0xE0,0x00,0xFC},{0x00,0x01,0x00,0x01,0x00}}, //code[87]
+		{{0x8C,0x50,0x20,0x50,0x8C},{0x01,0x00,0x00,0x00,0x01}}, //code[88]
+		{{0x1C,0x20,0xC0,0x20,0x1C},{0x00,0x00,0x01,0x00,0x00}}, //code[89]
+		{{0x84,0x44,0x24,0x14,0x0C},{0x01,0x01,0x01,0x01,0x01}}, //code[90]
+		{{0x00,0x04,0x04,0xFC,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[91]
+		{{0x54,0x58,0xF0,0x58,0x54},{0x00,0x00,0x01,0x00,0x00}}, //code[92]
+		{{0x00,0xFC,0x04,0x04,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[93]
+		{{0x10,0x08,0x04,0x08,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[94]
+		{{0x00,0x00,0x00,0x00,0x00},{0x01,0x01,0x01,0x01,0x01}}, //code[95]
+		{{0x00,0x04,0x08,0x10,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[96]
+		{{0x80,0x50,0x50,0x50,0xE0},{0x00,0x01,0x01,0x01,0x01}}, //code[97]
+		{{0xFC,0x20,0x10,0x10,0xE0},{0x01,0x01,0x01,0x01,0x00}}, //code[98]
+		{{0xE0,0x10,0x10,0x10,0x80},{0x00,0x01,0x01,0x01,0x00}}, //code[99]
+		{{0xE0,0x10,0x10,0x20,0xFC},{0x00,0x01,0x01,0x01,0x01}}, //code[100]
+		{{0xE0,0x50,0x50,0x50,0x60},{0x00,0x01,0x01,0x01,0x00}}, //code[101]
+		{{0x20,0xF8,0x24,0x04,0x08},{0x00,0x01,0x00,0x00,0x00}}, //code[102]
+		{{0x30,0x48,0x48,0x48,0xF8},{0x00,0x01,0x01,0x01,0x00}}, //code[103]
+		{{0xFC,0x20,0x10,0x10,0xE0},{0x01,0x00,0x00,0x00,0x01}}, //code[104]
+		{{0x00,0x10,0xF4,0x00,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[105]
+		{{0x80,0x00,0x10,0xF4,0x00},{0x00,0x01,0x01,0x00,0x00}}, //code[106]
+		{{0xFC,0x40,0xA0,0x10,0x00},{0x01,0x00,0x00,0x01,0x00}}, //code[107]
+		{{0x00,0x04,0xFC,0x00,0x00},{0x00,0x01,0x01,0x01,0x00}}, //code[108]
+		{{0xF0,0x10,0x60,0x10,0xE0},{0x01,0x00,0x00,0x00,0x01}}, //code[109]
+		{{0xF0,0x20,0x10,0x10,0xE0},{0x01,0x00,0x00,0x00,0x01}}, //code[110]
+		{{0xE0,0x10,0x10,0x10,0xE0},{0x00,0x01,0x01,0x01,0x00}}, //code[111]
+		{{0xF0,0x50,0x50,0x50,0x20},{0x01,0x00,0x00,0x00,0x00}}, //code[112]
+		{{0x20,0x50,0x50,0x60,0xF0},{0x00,0x00,0x00,0x00,0x01}}, //code[113]
+		{{0xF0,0x20,0x10,0x10,0x20},{0x01,0x00,0x00,0x00,0x00}}, //code[114]
+		{{0x20,0x50,0x50,0x50,0x80},{0x01,0x01,0x01,0x01,0x00}}, //code[115]
+		{{0x10,0xFC,0x10,0x00,0x80},{0x00,0x00,0x01,0x01,0x00}}, //code[116]
+		{{0xF0,0x00,0x00,0x80,0xF0},{0x00,0x01,0x01,0x00,0x01}}, //code[117]
+		{{0x70,0x80,0x00,0x80,0x70},{0x00,0x00,0x01,0x00,0x00}}, //code[118]
+		{{0xF0,0x00,0xC0,0x00,0xF0},{0x00,0x01,0x00,0x01,0x00}}, //code[119]
+		{{0x10,0xA0,0x40,0xA0,0x10},{0x01,0x00,0x00,0x00,0x01}}, //code[120]
+		{{0x30,0x40,0x40,0x40,0xF0},{0x00,0x01,0x01,0x01,0x00}}, //code[121]
+		{{0x10,0x90,0x50,0x30,0x10},{0x01,0x01,0x01,0x01,0x01}}, //code[122]
+		{{0x00,0x20,0xD8,0x04,0x00},{0x00,0x00,0x00,0x01,0x00}}, //code[123]
+		{{0x00,0x00,0xFC,0x00,0x00},{0x00,0x00,0x01,0x00,0x00}}, //code[124]
+		{{0x00,0x04,0xD8,0x20,0x00},{0x00,0x01,0x00,0x00,0x00}}, //code[125]
+		{{0x20,0x20,0xA8,0x70,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[126]
+		{{0x20,0x70,0xA8,0x20,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[127]
+	},
+	{ //shift 7
+		{{0x00,0x00,0x00,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[32]
+		{{0x00,0x00,0x9E,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[33]
+		{{0x00,0x0E,0x00,0x0E,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[34]
+		{{0x28,0xFE,0x28,0xFE,0x28},{0x00,0x00,0x00,0x00,0x00}}, //code[35]
+		{{0x48,0x54,0xFE,0x54,0x24},{0x00,0x00,0x00,0x00,0x00}}, //code[36]
+		{{0x46,0x26,0x10,0xC8,0xC4},{0x00,0x00,0x00,0x00,0x00}}, //code[37]
+		{{0x6C,0x92,0xAA,0x44,0xA0},{0x00,0x00,0x00,0x00,0x00}}, //code[38]
+		{{0x00,0x0A,0x06,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[39]
+		{{0x00,0x38,0x44,0x82,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[40]
+		{{0x00,0x82,0x44,0x38,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[41]
+		{{0x28,0x10,0x7C,0x10,0x28},{0x00,0x00,0x00,0x00,0x00}}, //code[42]
+		{{0x10,0x10,0x7C,0x10,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[43]
+		{{0x00,0xA0,0x60,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[44]
+		{{0x10,0x10,0x10,0x10,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[45]
+		{{0x00,0xC0,0xC0,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[46]
+		{{0x40,0x20,0x10,0x08,0x04},{0x00,0x00,0x00,0x00,0x00}}, //code[47]
+		{{0xFC,0xA2,0x92,0x8A,0xFC},{0x00,0x00,0x00,0x00,0x00}}, //code[48]
+		{{0x00,0x84,0xFC,0x80,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[49]
+		{{0x84,0xC2,0xA2,0x92,0x8C},{0x00,0x00,0x00,0x00,0x00}}, //code[50]
+		{{0x42,0x82,0x8A,0x96,0x62},{0x00,0x00,0x00,0x00,0x00}}, //code[51]
+		{{0x30,0x28,0x24,0xFC,0x20},{0x00,0x00,0x00,0x00,0x00}}, //code[52]
+		{{0x4E,0x8A,0x8A,0x8A,0x72},{0x00,0x00,0x00,0x00,0x00}}, //code[53]
+		{{0x78,0x94,0x92,0x92,0x60},{0x00,0x00,0x00,0x00,0x00}}, //code[54]
+		{{0x02,0xE2,0x12,0x0A,0x06},{0x00,0x00,0x00,0x00,0x00}}, //code[55]
+		{{0x6C,0x92,0x92,0x92,0x6C},{0x00,0x00,0x00,0x00,0x00}}, //code[56]
+		{{0x0C,0x92,0x92,0x52,0x3C},{0x00,0x00,0x00,0x00,0x00}}, //code[57]
+		{{0x00,0x6C,0x6C,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[58]
+		{{0x00,0xAC,0x6C,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[59]
+		{{0x10,0x28,0x44,0x82,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[60]
+		{{0x28,0x28,0x28,0x28,0x28},{0x00,0x00,0x00,0x00,0x00}}, //code[61]
+		{{0x00,0x82,0x44,0x28,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[62]
+		{{0x04,0x02,0xA2,0x12,0x0C},{0x00,0x00,0x00,0x00,0x00}}, //code[63]
+		{{0x64,0x92,0xF2,0x82,0x7C},{0x00,0x00,0x00,0x00,0x00}}, //code[64]
+		{{0xFC,0x22,0x22,0x22,0xFC},{0x00,0x00,0x00,0x00,0x00}}, //code[65]
+		{{0xFE,0x92,0x92,0x92,0x6C},{0x00,0x00,0x00,0x00,0x00}}, //code[66]
+		{{0x7C,0x82,0x82,0x82,0x44},{0x00,0x00,0x00,0x00,0x00}}, //code[67]
+		{{0xFE,0x82,0x82,0x44,0x38},{0x00,0x00,0x00,0x00,0x00}}, //code[68]
+		{{0xFE,0x92,0x92,0x92,0x82},{0x00,0x00,0x00,0x00,0x00}}, //code[69]
+		{{0xFE,0x12,0x12,0x12,0x02},{0x00,0x00,0x00,0x00,0x00}}, //code[70]
+		{{0x7C,0x82,0x92,0x92,0xF4},{0x00,0x00,0x00,0x00,0x00}}, //code[71]
+		{{0xFE,0x10,0x10,0x10,0xFE},{0x00,0x00,0x00,0x00,0x00}}, //code[72]
+		{{0x00,0x82,0xFE,0x82,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[73]
+		{{0x40,0x80,0x82,0xFE,0x02},{0x00,0x00,0x00,0x00,0x00}}, //code[74]
+		{{0xFE,0x10,0x28,0x44,0x82},{0x00,0x00,0x00,0x00,0x00}}, //code[75]
+		{{0xFE,0x80,0x80,0x80,0x80},{0x00,0x00,0x00,0x00,0x00}}, //code[76]
+		{{0xFE,0x04,0x18,0x04,0xFE},{0x00,0x00,0x00,0x00,0x00}}, //code[77]
+		{{0xFE,0x08,0x10,0x20,0xFE},{0x00,0x00,0x00,0x00,0x00}}, //code[78]
+		{{0x7C,0x82,0x82,0x82,0x7C},{0x00,0x00,0x00,0x00,0x00}}, //code[79]
+		{{0xFE,0x12,0x12,0x12,0x0C},{0x00,0x00,0x00,0x00,0x00}}, //code[80]
+		{{0x7C,0x82,0xA2,0x42,0xBC},{0x00,0x00,0x00,0x00,0x00}}, //code[81]
+		{{0xFC,0x12,0x32,0x52,0x8C},{0x00,0x00,0x00,0x00,0x00}}, //code[82]
+		{{0x8C,0x92,0x92,0x92,0x62},{0x00,0x00,0x00,0x00,0x00}}, //code[83]
+		{{0x02,0x02,0xFE,0x02,0x02},{0x00,0x00,0x00,0x00,0x00}}, //code[84]
+		{{0x7E,0x80,0x80,0x80,0x7E},{0x00,0x00,0x00,0x00,0x00}}, //code[85]
+		{{0x3E,0x40,0x80,0x40,0x3E},{0x00,0x00,0x00,0x00,0x00}}, //code[86]
+		{{0x7E,0x80,0x70,0x80,0x7E},{0x00,0x00,0x00,0x00,0x00}}, //code[87]
+		{{0xC6,0x28,0x10,0x28,0xC6},{0x00,0x00,0x00,0x00,0x00}}, //code[88]
+		{{0x0E,0x10,0xE0,0x10,0x0E},{0x00,0x00,0x00,0x00,0x00}}, //code[89]
+		{{0xC2,0xA2,0x92,0x8A,0x86},{0x00,0x00,0x00,0x00,0x00}}, //code[90]
+		{{0x00,0x82,0x82,0xFE,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[91]
+		{{0x2A,0x2C,0xF8,0x2C,0x2A},{0x00,0x00,0x00,0x00,0x00}}, //code[92]
+		{{0x00,0xFE,0x82,0x82,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[93]
+		{{0x08,0x04,0x02,0x04,0x08},{0x00,0x00,0x00,0x00,0x00}}, //code[94]
+		{{0x80,0x80,0x80,0x80,0x80},{0x00,0x00,0x00,0x00,0x00}}, //code[95]
+		{{0x00,0x02,0x04,0x08,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[96]
+		{{0x40,0xA8,0xA8,0xA8,0xF0},{0x00,0x00,0x00,0x00,0x00}}, //code[97]
+		{{0xFE,0x90,0x88,0x88,0x70},{0x00,0x00,0x00,0x00,0x00}}, //code[98]
+		{{0x70,0x88,0x88,0x88,0x40},{0x00,0x00,0x00,0x00,0x00}}, //code[99]
+		{{0x70,0x88,0x88,0x90,0xFE},{0x00,0x00,0x00,0x00,0x00}}, //code[100]
+		{{0x70,0xA8,0xA8,0xA8,0x30},{0x00,0x00,0x00,0x00,0x00}}, //code[101]
+		{{0x10,0xFC,0x12,0x02,0x04},{0x00,0x00,0x00,0x00,0x00}}, //code[102]
+		{{0x18,0xA4,0xA4,0xA4,0x7C},{0x00,0x00,0x00,0x00,0x00}}, //code[103]
+		{{0xFE,0x10,0x08,0x08,0xF0},{0x00,0x00,0x00,0x00,0x00}}, //code[104]
+		{{0x00,0x88,0xFA,0x80,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[105]
+		{{0x40,0x80,0x88,0x7A,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[106]
+		{{0xFE,0x20,0x50,0x88,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[107]
+		{{0x00,0x82,0xFE,0x80,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[108]
+		{{0xF8,0x08,0x30,0x08,0xF0},{0x00,0x00,0x00,0x00,0x00}}, //code[109]
+		{{0xF8,0x10,0x08,0x08,0xF0},{0x00,0x00,0x00,0x00,0x00}}, //code[110]
+		{{0x70,0x88,0x88,0x88,0x70},{0x00,0x00,0x00,0x00,0x00}}, //code[111]
+		{{0xF8,0x28,0x28,0x28,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[112]
+		{{0x10,0x28,0x28,0x30,0xF8},{0x00,0x00,0x00,0x00,0x00}}, //code[113]
+		{{0xF8,0x10,0x08,0x08,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[114]
+		{{0x90,0xA8,0xA8,0xA8,0x40},{0x00,0x00,0x00,0x00,0x00}}, //code[115]
+		{{0x08,0x7E,0x88,0x80,0x40},{0x00,0x00,0x00,0x00,0x00}}, //code[116]
+		{{0x78,0x80,0x80,0x40,0xF8},{0x00,0x00,0x00,0x00,0x00}}, //code[117]
+		{{0x38,0x40,0x80,0x40,0x38},{0x00,0x00,0x00,0x00,0x00}}, //code[118]
+		{{0x78,0x80,0x60,0x80,0x78},{0x00,0x00,0x00,0x00,0x00}}, //code[119]
+		{{0x88,0x50,0x20,0x50,0x88},{0x00,0x00,0x00,0x00,0x00}}, //code[120]
+		{{0x18,0xA0,0xA0,0xA0,0x78},{0x00,0x00,0x00,0x00,0x00}}, //code[121]
+		{{0x88,0xC8,0xA8,0x98,0x88},{0x00,0x00,0x00,0x00,0x00}}, //code[122]
+		{{0x00,0x10,0x6C,0x82,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[123]
+		{{0x00,0x00,0xFE,0x00,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[124]
+		{{0x00,0x82,0x6C,0x10,0x00},{0x00,0x00,0x00,0x00,0x00}}, //code[125]
+		{{0x10,0x10,0x54,0x38,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[126]
+		{{0x10,0x38,0x54,0x10,0x10},{0x00,0x00,0x00,0x00,0x00}}, //code[127]
+	},
+};
+
+#endif /* FONT_SHIFT_H_ */
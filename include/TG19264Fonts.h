@@ -10,39 +10,7 @@
 #define FONTS_H_
 
 #ifndef USE_CUSTOM
-const uint8_t default_f[128][5] = { //ASCII code ENG only
-	{0x0}, //blank code[0]
-	{0x0}, //blank code[1]
-	{0x0}, //blank code[2]
-	{0x0}, //blank code[3]
-	{0x0}, //blank code[4]
-	{0x0}, //blank code[5]
-	{0x0}, //blank code[6]
-	{0x0}, //blank code[7]
-	{0x0}, //blank code[8]
-	{0x0}, //blank code[9]
-	{0x0}, //blank code[10]
-	{0x0}, //blank code[11]
-	{0x0}, //blank code[12]
-	{0x0}, //blank code[13]
-	{0x0}, //blank code[14]
-	{0x0}, //blank code[15]
-	{0x0}, //blank code[16]
-	{0x0}, //blank code[17]
-	{0x0}, //blank code[18]
-	{0x0}, //blank code[19]
-	{0x0}, //blank code[20]
-	{0x0}, //blank code[21]
-	{0x0}, //blank code[22]
-	{0x0}, //blank code[23]
-	{0x0}, //blank code[24]
-	{0x0}, //blank code[25]
-	{0x0}, //blank code[26]
-	{0x0}, //blank code[27]
-	{0x0}, //blank code[28]
-	{0x0}, //blank code[29]
-	{0x0}, //blank code[30]
-	{0x0}, //blank code[31]
+const uint8_t default_f[96][5] TG_PROGMEM = { //ASCII codes 32..127 ENG only, read with TG_READ_BYTE
 	{0x0}, //blank code[32]
 	{0x0,0x0,0x4F,0x0,0x0}, //'!' code[33]
 	{0x0,0x7,0x0,0x7,0x0}, //'"' code[34]
@@ -140,8 +108,16 @@ const uint8_t default_f[128][5] = { //ASCII code ENG only
 	{0x8,0x8,0x2A,0x1C,0x8}, //'right arrow' code[126]
 	{0x8,0x1C,0x2A,0x8,0x8} //'left arrow' code[127]
 };
+#define DEFAULT_F_FIRST ' '
+#else
+//custom table (USE_CUSTOM) defined by user keeps layout of previous versions: 5 columns of
+//every code 0..127, in program memory (TG_PROGMEM)
+extern const uint8_t default_f[128][5];
+#define DEFAULT_F_FIRST 0
 #endif //!_USE_CUSTOM_
 
+const TG_font_st TG_font_default = {DEFAULT_F_FIRST, 127, 1, 5, 0, 0, &default_f[0][0]};
+
 
 
 
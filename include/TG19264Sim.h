@@ -0,0 +1,103 @@
+/*
+ * TG19264Sim.h
+ *
+ * Host side simulation of the TG19264A bus (3x KS0108 controllers).
+ * Used when library is compiled with TG_HOST defined.
+ */
+
+
+#ifndef TG19264SIM_H_
+#define TG19264SIM_H_
+
+#include <inttypes.h>
+#include <stdio.h>
+
+//Modelled bus timings in ns (KS0108 datasheet: tcyc >= 1000ns, PWEH/PWEL >= 450ns)
+#ifndef TG_SIM_EDGE_NS
+#define TG_SIM_EDGE_NS 500
+#endif
+//Modelled time for which chip reports busy after every instruction, data write or read
+#ifndef TG_SIM_BUSY_NS
+#define TG_SIM_BUSY_NS 1000
+#endif
+
+//Registers seen by library through TG19264Config.h host section
+typedef struct
+{
+	uint8_t data_port;
+	uint8_t data_ddr;
+	uint8_t data_pin;
+	uint8_t ctrl_port;
+	uint8_t ctrl_ddr;
+} tg_sim_reg_st;
+
+//State of one KS0108 controller
+typedef struct
+{
+	uint8_t ram[8][64];
+	uint8_t page;
+	uint8_t col;
+	uint8_t start_line;
+	uint8_t on;
+	uint8_t out_reg;
+	uint64_t busy_until;
+} tg_sim_chip_st;
+
+//Bus transaction counters
+typedef struct
+{
+	uint32_t strobes;			//E cycles
+	uint32_t data_writes;		//display data bytes written
+	uint32_t data_reads;		//display data bytes read (dummy reads included)
+	uint32_t cmd_writes;		//instruction bytes
+	uint32_t addr_cmds;			//page (X) and column (Y) address instructions
+	uint32_t status_reads;		//busy flag polls
+	uint32_t busy_violations;	//writes or data reads issued while selected chip was busy
+	uint64_t time_ns;			//modelled bus time
+} tg_sim_stats_st;
+
+extern volatile tg_sim_reg_st tg_sim_reg;
+extern tg_sim_chip_st tg_sim_chip[3];
+extern tg_sim_stats_st tg_sim_stats;
+
+//Bit numbers of control lines in tg_sim_reg.ctrl_port
+#define TG_SIM_RS	0
+#define TG_SIM_RW	1
+#define TG_SIM_E	2
+#define TG_SIM_CS1	3
+#define TG_SIM_CS2	4
+#define TG_SIM_CS3	5
+#define TG_SIM_RES	6
+
+/************************************************************************/
+/* Power-on reset of simulated display, clears RAM and counters         */
+/************************************************************************/
+void tg_sim_reset(void);
+
+/************************************************************************/
+/* Clears bus transaction counters                                      */
+/************************************************************************/
+void tg_sim_clear_stats(void);
+
+/************************************************************************/
+/* Called after every change of E line, processes strobe edge           */
+/************************************************************************/
+void tg_sim_strobe(uint16_t ns);
+
+/************************************************************************/
+/* Models delay given in ns                                             */
+/************************************************************************/
+void tg_sim_delay_ns(uint32_t ns);
+
+/************************************************************************/
+/* Returns 1 when pixel (x,y) is lit on screen (start line and on/off
+state applied), coordinates same as in library API                      */
+/************************************************************************/
+uint8_t tg_sim_pixel(uint8_t x, uint8_t y);
+
+/************************************************************************/
+/* Prints screen as text, '#' for lit pixel                             */
+/************************************************************************/
+void tg_sim_print(FILE * out);
+
+#endif /* TG19264SIM_H_ */
@@ -6,9 +6,16 @@
  */ 
 
 #include <inttypes.h>
-#include "TG19264Fonts.h"
 #include "TG19264ALib.h"
 #include "TG19264Config.h"
+#include "TG19264Bus.h"
+#include "TG19264Fonts.h"
+#ifdef USE_CUSTOM
+#undef TG_SHIFTED_FONT //shifted tables are generated from built-in font
+#endif
+#ifdef TG_SHIFTED_FONT
+#include "TG19264FontShift.h"
+#endif
 
 #define BadValue 128
 #define true 1
@@ -22,25 +29,125 @@
 #define YPoints 64
 #define YPointsPerPage 8
 
+#if defined(TG_DEFERRED_FLUSH) && !defined(TG_SHADOW_BUFFER)
+#define TG_SHADOW_BUFFER //deferred mode draws into shadow only
+#endif
 
-#define strobe_enable (E_PIN_PORT ^= HIGH <<  E_PIN_NUM); DELAY_200NS
-#define strobe_enable_fast (E_PIN_PORT ^= HIGH <<  E_PIN_NUM); DELAY_STROBE_FAST
-#define strobe_reset (RES_PIN_PORT ^= HIGH <<  RES_PIN_NUM)
+//display lines are driven through bus backend (TG19264Bus.h)
+#define strobe_enable TG_BUS_E_TOGGLE(); DELAY_200NS
+#define strobe_enable_fast TG_BUS_E_TOGGLE(); DELAY_STROBE_FAST
+#define strobe_reset TG_BUS_RES_TOGGLE()
 
-#define cs1_deselect (CS1_PIN_PORT |= HIGH << CS1_PIN_NUM)
-#define cs1_select (CS1_PIN_PORT &= ~(HIGH << CS1_PIN_NUM))
-#define cs2_deselect (CS2_PIN_PORT |= HIGH << CS2_PIN_NUM)
-#define cs2_select (CS2_PIN_PORT &= ~(HIGH << CS2_PIN_NUM))
-#define cs3_deselect (CS3_PIN_PORT |= HIGH << CS3_PIN_NUM)
-#define cs3_select (CS3_PIN_PORT &= ~(HIGH << CS3_PIN_NUM))
+#define cs1_deselect TG_BUS_CS1_DESELECT()
+#define cs1_select TG_BUS_CS1_SELECT()
+#define cs2_deselect TG_BUS_CS2_DESELECT()
+#define cs2_select TG_BUS_CS2_SELECT()
+#define cs3_deselect TG_BUS_CS3_DESELECT()
+#define cs3_select TG_BUS_CS3_SELECT()
 
-#define read_rs ( (HIGH << RS_PIN_NUM) & RS_PIN_READ)
-#define set_type_data (RS_PIN_PORT |= HIGH << RS_PIN_NUM)
-#define set_type_cmd (RS_PIN_PORT &= ~(HIGH << RS_PIN_NUM))
-#define set_state_read (RW_PIN_PORT |= HIGH << RW_PIN_NUM)
-#define set_state_write (RW_PIN_PORT &= ~(HIGH << RW_PIN_NUM))
+#define read_rs TG_BUS_RS_STATE()
+#define set_type_data TG_BUS_RS_DATA()
+#define set_type_cmd TG_BUS_RS_CMD()
+#define set_state_read TG_BUS_RW_READ()
+#define set_state_write TG_BUS_RW_WRITE()
 
 static uint8_t page_buff[64]; //for library use only. Internal buffer!
+static uint8_t mask_buff[64]; //bits changed by display list in every column of page
+
+//command types of display list
+#define CMD_FILL 1 //box (x,y) of w x h, arg is fill mode
+#define CMD_IMAGE 2 //image of w x h at (x,y), arg is memory of image
+#define CMD_LINE 3 //line from (x,y) to (w,h)
+#define CMD_TEXT 4 //text at (x,y), arg is space between letters
+#define CMD_RECT 5 //outline from (x,y) to (x+w,y+h), arg is style
+
+#define IMG_RAM 0
+#define IMG_FLASH 1 //image in program memory (TG_PROGMEM)
+//reads byte of image from memory it is placed in
+#define img_read(ptr, mem) (IMG_FLASH == (mem) ? TG_READ_BYTE(ptr) : *(ptr))
+
+#define RASTER_MASK 0 //rasterizer ORs bits it changes into buffer
+#define RASTER_DRAW 1 //rasterizer draws into buffer
+#define RUN_GAP 2 //unchanged columns rewritten instead of starting new run
+
+static TG_cmd_st * list_buff; //display list being recorded
+static uint8_t list_size; //0 when drawing directly
+static uint8_t list_count;
+static uint8_t raster_xor; //command of page depends on previous state of bits
+
+static uint8_t chip_sel; //chips drawing goes to, bits same as chip_id
+static uint8_t bus_sel; //chips with CS line asserted (differs from chip_sel only in deferred mode)
+//address counters of every chip known from commands sent, valid bits same as chip_id
+static uint8_t addr_page[3];
+static uint8_t addr_col[3];
+static uint8_t addr_page_valid;
+static uint8_t addr_col_valid;
+static uint8_t start_line; //display RAM line shown at top, set by TG_scroll_v
+
+#ifdef TG_SHADOW_BUFFER
+static uint8_t shadow[3][YPoints/YPointsPerPage][XPointsPerChip]; //copy of display RAM [chip][page][col]
+static uint8_t shadow_page[3]; //address counters used for shadow (ahead of display in deferred mode)
+static uint8_t shadow_col[3];
+#endif
+
+#ifdef TG_DEFERRED_FLUSH
+#define SCAN_END (3 * YPoints/YPointsPerPage * XPointsPerChip) //scan_pos after last page of last chip
+#define START_WRAP 2 //start line waits till scan wraps to first page
+#define START_POS 1 //start line waits till scan passes start_line_pos again
+static uint8_t dirty[3][YPoints/YPointsPerPage][XPointsPerChip/8]; //changed columns of page, bit per column
+static uint8_t flush_pending; //something drawn since TG_poll reported display up to date
+static uint8_t flush_chips; //chips of run being sent by TG_poll, 0 when no run started
+static uint8_t flush_page;
+static uint8_t flush_col;
+static uint8_t flush_end;
+static uint16_t scan_pos; //place TG_poll looks for changes from, (page * 3 + chip) * 64 + column
+static uint8_t start_line_pending; //start line changed by TG_scroll_v and not sent yet, START_WRAP or START_POS
+static uint16_t start_line_pos; //scan_pos at scroll, start line is sent when scan comes there again
+static void (*flush_callback)(void);
+#endif
+
+#ifdef TG_STATS
+static TG_stats_st stats; //counters of TG_get_stats, TG_LOCK guards them as TG_poll may count from interrupt
+
+//counts call of public function, returns timestamp of its start
+static uint32_t stat_begin(uint8_t api)
+{
+	TG_LOCK;
+	stats.calls[api]++;
+	TG_UNLOCK;
+	return TG_TIMESTAMP();
+}
+
+//adds time of public function call started by stat_begin
+static void stat_end(uint8_t api, uint32_t start)
+{
+	uint32_t time = TG_TIMESTAMP() - start;
+	TG_LOCK;
+	stats.time[api] += time;
+	TG_UNLOCK;
+}
+
+//counts busy flag polls of one wait
+static void stat_busy(uint16_t spins)
+{
+	TG_LOCK;
+	stats.busy_spins += spins;
+	if (spins > stats.busy_spins_max)
+		stats.busy_spins_max = spins;
+	TG_UNLOCK;
+}
+
+//STAT_BEGIN at start of public function, STAT_END or STAT_RETURN at every exit of it
+#define STAT_BEGIN(api) uint32_t stat_start = stat_begin(api)
+#define STAT_END(api) stat_end(api, stat_start)
+#define stat_add(counter, n) do { TG_LOCK; stats.counter += (n); TG_UNLOCK; } while (0)
+#else
+#define STAT_BEGIN(api)
+#define STAT_END(api)
+#define stat_add(counter, n)
+#define stat_busy(spins) (void)(spins)
+#endif
+#define STAT_RETURN(api) do { STAT_END(api); return; } while (0)
 
 //struct for acquiring information about bytes to send per chipId and chipID for start
 typedef struct 
@@ -49,18 +156,10 @@ typedef struct
 	uint8_t start_id;
 } tx_info_st;
 
-//Gives needed information to functions about starting point, offset for mask and bytes to send;
-typedef struct
-{
-	uint8_t page;
-	uint8_t col;
-	int8_t offset;
-	uint8_t bytes_to_send;
-} tx_param_st;
-
-//used for selecting one chip 
-static void select_chip(uint8_t ID)
+//asserts CS lines of chips, used directly by commands and flush
+static void bus_select(uint8_t ID)
 {
+	bus_sel |= ID;
 	if (TG_left_disp & ID)
 		cs1_select;
 	if (TG_mid_disp & ID)
@@ -69,9 +168,10 @@ static void select_chip(uint8_t ID)
 		cs3_select;
 }
 
-//used for deselecting one chip
-static void deselect_chip(uint8_t ID)
+//releases CS lines of chips
+static void bus_deselect(uint8_t ID)
 {
+	bus_sel &= ~ID;
 	if (TG_left_disp & ID)
 		cs1_deselect;
 	if (TG_mid_disp & ID)
@@ -80,27 +180,52 @@ static void deselect_chip(uint8_t ID)
 		cs3_deselect;
 }
 
+//used for selecting chips for drawing, in deferred mode only shadow is selected
+static void select_chip(uint8_t ID)
+{
+	chip_sel |= ID;
+#ifndef TG_DEFERRED_FLUSH
+	bus_select(ID);
+#endif
+}
+
+//used for deselecting chips after drawing
+static void deselect_chip(uint8_t ID)
+{
+	chip_sel &= ~ID;
+#ifndef TG_DEFERRED_FLUSH
+	bus_deselect(ID);
+#endif
+}
+
 //reads byte from display
 static uint8_t get_byte(void)
 {
 	uint8_t data;
 	strobe_enable;
-	data = DATA_READ;
+	data = TG_BUS_READ();
 	strobe_enable_fast;
 	return data;
 }
 
+//reads status till busy flag is cleared, data lines have to be input and RS low
+static inline void poll_busy(void)
+{
+	uint16_t spins = 0;
+	while (get_byte() & (HIGH << BUSY_FLAG))
+		spins++;
+	stat_busy(spins);
+}
+
 //wait till display ready to write
 static void wait_busy(void)
 {
-	DATA_DDR = INPUT_8BIT;
-	DATA_PORT = PULLUP_8BIT;
+	TG_BUS_DATA_INPUT();
 	set_state_read;
 	uint8_t rs_state = read_rs;
 	set_type_cmd;
-	while (get_byte() & (HIGH << BUSY_FLAG));
-	DATA_PORT = LOW;
-	DATA_DDR = OUTPUT_8BIT;
+	poll_busy();
+	TG_BUS_DATA_OUTPUT();
 	set_state_write;
 	if (rs_state)
 		set_type_data;
@@ -108,20 +233,159 @@ static void wait_busy(void)
 		set_type_cmd;
 }
 
-static void send_byte(uint8_t byte)
+//sends byte and always waits for busy flag (on/off and start line commands)
+static void send_byte_wait(uint8_t byte)
 {
 	strobe_enable_fast;
-	DATA_PORT = byte;
+	TG_BUS_WRITE(byte);
 	strobe_enable_fast;
 	wait_busy();
 }
 
-static void set_address(uint8_t page, uint8_t col)
+//sends byte, in TG_BUSY_OPEN_LOOP mode fixed delay is used instead of busy flag
+static void send_byte(uint8_t byte)
+{
+#ifdef TG_BUSY_OPEN_LOOP
+	strobe_enable_fast;
+	TG_BUS_WRITE(byte);
+	strobe_enable_fast;
+	DELAY_BUSY;
+#else
+	send_byte_wait(byte);
+#endif
+}
+
+//waits till display ready after data read, leaves RS in data state
+#ifdef TG_BUSY_OPEN_LOOP
+#define read_wait DELAY_BUSY
+#else
+#define read_wait set_type_cmd; poll_busy(); set_type_data
+#endif
+
+/************************************************************************/
+/* Sends address commands to selected chips. Command is skipped when
+address counter of every selected chip already points there             */
+/************************************************************************/
+static void send_address(uint8_t page, uint8_t col)
 {
+	page &= 0x07;
+	col &= 0x3F;
+	uint8_t send_page = (addr_page_valid & bus_sel) != bus_sel;
+	uint8_t send_col = (addr_col_valid & bus_sel) != bus_sel;
+	for (uint8_t chip = 0; chip < 3; chip++)
+	{
+		if (bus_sel & (HIGH << chip))
+		{
+			if (addr_page[chip] != page)
+				send_page = true;
+			if (addr_col[chip] != col)
+				send_col = true;
+			addr_page[chip] = page;
+			addr_col[chip] = col;
+		}
+	}
+	addr_page_valid |= bus_sel;
+	addr_col_valid |= bus_sel;
+	if (!send_page && !send_col)
+		return;
 	set_type_cmd;
-	send_byte(0x40 | (0x3F & col));
-	send_byte(0xB8 | (0x07 & page));
+	if (send_col)
+		send_byte(0x40 | col);
+	if (send_page)
+		send_byte(0xB8 | page);
 	set_type_data;
+	stat_add(commands, send_col + send_page);
+}
+
+//column counter of selected chips is incremented by display after every data read/write
+static void advance_col(uint8_t bytes)
+{
+	for (uint8_t chip = 0; chip < 3; chip++)
+	{
+		if (bus_sel & (HIGH << chip))
+			addr_col[chip] = (addr_col[chip] + bytes) & 0x3F;
+	}
+}
+
+static void set_address(uint8_t page, uint8_t col)
+{
+	stat_add(addresses, 1);
+	page += start_line / YPointsPerPage; //RAM page shown at page of screen
+#ifndef TG_DEFERRED_FLUSH
+	send_address(page, col);
+#endif
+#ifdef TG_SHADOW_BUFFER
+	for (uint8_t chip = 0; chip < 3; chip++)
+	{
+		if (chip_sel & (HIGH << chip))
+		{
+			shadow_page[chip] = 0x07 & page;
+			shadow_col[chip] = 0x3F & col;
+		}
+	}
+#endif
+}
+
+#ifdef TG_SHADOW_BUFFER
+/************************************************************************/
+/* Writes byte to shadow of every selected chip and increments column
+the same way display does after data write                              */
+/************************************************************************/
+static void shadow_write(uint8_t byte)
+{
+#ifdef TG_DEFERRED_FLUSH
+	TG_LOCK; //TG_poll may run from interrupt
+	flush_pending = true;
+#endif
+	for (uint8_t chip = 0; chip < 3; chip++)
+	{
+		if (chip_sel & (HIGH << chip))
+		{
+			uint8_t page = shadow_page[chip];
+			uint8_t col = shadow_col[chip];
+			shadow[chip][page][col] = byte;
+			shadow_col[chip] = (col + 1) & 0x3F;
+#ifdef TG_DEFERRED_FLUSH
+			dirty[chip][page][col / 8] |= HIGH << (col % 8);
+#endif
+		}
+	}
+#ifdef TG_DEFERRED_FLUSH
+	TG_UNLOCK;
+#endif
+}
+#endif
+
+#ifdef TG_DEFERRED_FLUSH
+//checks if shadows of all chips in chip_mask hold the same bytes in given columns
+static uint8_t shadow_equal(uint8_t chip_mask, uint8_t page, uint8_t start, uint8_t end)
+{
+	uint8_t first = 0;
+	while (!(chip_mask & (HIGH << first)))
+		first++;
+	for (uint8_t chip = first + 1; chip < 3; chip++)
+	{
+		if (!(chip_mask & (HIGH << chip)))
+			continue;
+		for (uint8_t col = start; col < end; col++)
+			if (shadow[chip][page][col] != shadow[first][page][col])
+				return false;
+	}
+	return true;
+}
+#endif
+
+//sends 1 byte of display data to selected address
+static void send_data_byte(uint8_t byte)
+{
+#ifndef TG_DEFERRED_FLUSH
+	send_byte(byte);
+	advance_col(1);
+	stat_add(data_written, 1);
+#endif
+#ifdef TG_SHADOW_BUFFER
+	shadow_write(byte);
+#endif
 }
 
 /*
@@ -129,8 +393,31 @@ Sends data to selected address, chipID for selecting part 1=left 2=middle 4=righ
 sum for simultaneously turning few segments*/
 static void send_data(uint8_t size, const uint8_t * buff)
 {
+#ifndef TG_DEFERRED_FLUSH
+	for (uint8_t i = 0; i < size; i++)
+		send_byte(buff[i]);
+	advance_col(size); //address counters are updated once per run
+	stat_add(data_written, size);
+#endif
+#ifdef TG_SHADOW_BUFFER
+	for (uint8_t i = 0; i < size; i++)
+		shadow_write(buff[i]);
+#endif
+}
+
+// used by clearDisplayFull
+static void send_pattern(uint8_t size, uint8_t pattern)
+{
+#ifndef TG_DEFERRED_FLUSH
+	for (uint8_t i = 0; i < size; i++)
+		send_byte(pattern);
+	advance_col(size);
+	stat_add(data_written, size);
+#endif
+#ifdef TG_SHADOW_BUFFER
 	for (uint8_t i = 0; i < size; i++)
-		send_byte(*buff++);
+		shadow_write(pattern);
+#endif
 }
 
 /***
@@ -140,10 +427,7 @@ static void test_fill_page(uint8_t page, uint8_t pattern, uint8_t chipID)
 {
 	select_chip(chipID);
 	set_address(page,0);
-	for (uint8_t i = 0; i < 64; i++)
-	{
-		send_byte(pattern);
-	}
+	send_pattern(64, pattern);
 	deselect_chip(chipID);
 }
 
@@ -152,24 +436,42 @@ Reads data from selected address, chipID for selecting part 1=left 2=middle 4=ri
 sum for simultaneously turning few segments*/
 static void read_data(uint8_t size, uint8_t * buff)
 {
+#ifdef TG_SHADOW_BUFFER
+	//data taken from shadow of first selected chip, display isn't read at all
+	uint8_t chip = 0;
+	while (chip < 2 && !(chip_sel & (HIGH << chip)))
+		chip++;
+	const uint8_t * src = &shadow[chip][shadow_page[chip]][shadow_col[chip]];
+	for (uint8_t i = 0; i < size; i++)
+		*buff++ = *src++;
+#else
 	set_state_read;
-	DATA_DDR = INPUT_8BIT;
-	DATA_PORT = PULLUP_8BIT;
+	TG_BUS_DATA_INPUT();
 	set_type_data;
 	get_byte();
-	set_type_cmd;
-	while (get_byte() & (HIGH << BUSY_FLAG));
+	read_wait;
 	for (uint8_t i = 0; i < size; i++)
 	{
-		set_type_data;
 		*buff++ = get_byte();
-		set_type_cmd;
-		while (get_byte() & (HIGH << BUSY_FLAG));
+		read_wait;
 	}
-	DATA_PORT = LOW;
-	DATA_DDR = OUTPUT_8BIT;
+	TG_BUS_DATA_OUTPUT();
 	set_state_write;
 	set_type_data;
+	addr_col_valid &= ~bus_sel; //dummy read makes column counter uncertain
+	stat_add(data_read, size + 1);
+#endif
+}
+
+//sends instruction to chips and waits till they are ready (on/off, start line)
+static void chip_command(uint8_t cmd, uint8_t chip_id)
+{
+	set_type_cmd;
+	bus_select(chip_id);
+	send_byte_wait(cmd);
+	stat_add(commands, 1);
+	bus_deselect(chip_id);
+	set_type_data;
 }
 
 /*
@@ -177,91 +479,64 @@ Gives possibility for shift up/down, chipID for selecting part 1=left 2=middle 4
 sum for simultaneously turning few segments*/
 static void set_start_line(uint8_t start, uint8_t chip_id)
 {
-	set_type_cmd;
-	select_chip(chip_id);
-	send_byte(0xC0 | start);
-	deselect_chip(chip_id);
-	set_type_data;
+	start_line = start;
+	chip_command(0xC0 | start, chip_id);
 }
 
-
 /*
-Initializes ports for work with display
+Sets start line of all chips for scrolling. In deferred mode start line is sent
+by TG_poll when its scan comes round to place where it was at scroll, data drawn
+before scroll is on display then. Scroll while start line waits keeps its place,
+so scrolling all the time can't hold it back
 */
-void TG_init(void)
+static void scroll_to(uint8_t start)
 {
-	//initialize MCU interface
-	DATA_DDR = OUTPUT_8BIT;
-	DATA_PORT = LOW;
-	//RS config
-	RS_PIN_DDR |= OUTPUT << RS_PIN_NUM;
-	RS_PIN_PORT &= ~(HIGH << RS_PIN_NUM);
-	//RW config
-	RW_PIN_DDR |= OUTPUT << RW_PIN_NUM;
-	RW_PIN_PORT &= ~(HIGH << RW_PIN_NUM);
-	//Enable config
-	E_PIN_DDR |= OUTPUT << E_PIN_NUM;
-	E_PIN_PORT &= ~(HIGH << E_PIN_NUM);
-	//CS1 config
-	CS1_PIN_DDR |= OUTPUT << CS1_PIN_NUM;
-	CS1_PIN_PORT &= ~(HIGH << CS1_PIN_NUM);
-	//CS2 config
-	CS2_PIN_DDR |= OUTPUT << CS2_PIN_NUM;
-	CS2_PIN_PORT &= ~(HIGH << CS2_PIN_NUM);
-	//CS3 config
-	CS3_PIN_DDR |= OUTPUT << CS3_PIN_NUM;
-	CS3_PIN_PORT &= ~(HIGH << CS3_PIN_NUM);
-	//RES config
-	RES_PIN_DDR |= OUTPUT << RES_PIN_NUM;
-	RES_PIN_PORT &= ~(HIGH << RES_PIN_NUM);
-	
-	//initialize display
-	strobe_reset;
-	set_type_data;
-	set_state_write;
-	DELAY_MS(35);
-	TG_turn_on(0x7);
-	set_start_line(0,0x7);
-	cs1_deselect;
-	cs2_deselect;
-	cs3_deselect;
+#ifdef TG_DEFERRED_FLUSH
+	TG_LOCK; //TG_poll may run from interrupt
+	start_line = start;
+	if (!start_line_pending)
+	{
+		start_line_pending = START_WRAP;
+		start_line_pos = scan_pos;
+	}
+	flush_pending = true;
+	TG_UNLOCK;
+#else
+	set_start_line(start, TG_left_disp | TG_mid_disp | TG_right_disp);
+#endif
 }
 
 void TG_turn_on(uint8_t chip_id)
 {
-	set_type_cmd;
-	select_chip(chip_id);
-	send_byte(0x3F);
-	deselect_chip(chip_id);
-	set_type_data;
+	STAT_BEGIN(TG_stat_turn_on);
+	chip_command(0x3F, chip_id);
+	STAT_END(TG_stat_turn_on);
 }
 
 void TG_turn_off(uint8_t chip_id)
 {
-	set_type_cmd;
-	select_chip(chip_id);
-	send_byte(0x3E);
-	deselect_chip(chip_id);
-	set_type_data;
+	STAT_BEGIN(TG_stat_turn_off);
+	chip_command(0x3E, chip_id);
+	STAT_END(TG_stat_turn_off);
 }
 
 uint8_t TG_get_stat(uint8_t chip_id)
 {
-	DATA_DDR = INPUT_8BIT;
-	DATA_PORT = PULLUP_8BIT;
+	STAT_BEGIN(TG_stat_get_stat);
+	TG_BUS_DATA_INPUT();
 	set_state_read;
 	uint8_t rs_state = read_rs;
 	set_type_cmd;
-	select_chip(chip_id);
+	bus_select(chip_id);
 	uint8_t res = get_byte();
-	deselect_chip(chip_id);
-	DATA_PORT = LOW;
-	DATA_DDR = OUTPUT_8BIT;
+	bus_deselect(chip_id);
+	TG_BUS_DATA_OUTPUT();
 	set_state_write;
 	if (rs_state)
 		set_type_data;
 	else
 		set_type_cmd;
+	STAT_END(TG_stat_get_stat);
 	return res;
 }
 
@@ -304,6 +579,9 @@ static uint8_t calc_tx_info(uint8_t min, uint8_t max, tx_info_st * info)
 /************************************************************************/
 static void select_1_chip(uint8_t chip_id)
 {
+	chip_sel |= HIGH << chip_id;
+#ifndef TG_DEFERRED_FLUSH //drawing goes to shadow only in deferred mode
+	bus_sel |= HIGH << chip_id;
 	switch(chip_id)
 	{
 		case 0 : cs1_select;
@@ -313,6 +591,7 @@ static void select_1_chip(uint8_t chip_id)
 		case 2: cs3_select;
 				break;
 	}
+#endif
 }
 
 /************************************************************************/
@@ -321,6 +600,9 @@ static void select_1_chip(uint8_t chip_id)
 /************************************************************************/
 static void deselect_1_chip(uint8_t chip_id)
 {
+	chip_sel &= ~(HIGH << chip_id);
+#ifndef TG_DEFERRED_FLUSH
+	bus_sel &= ~(HIGH << chip_id);
 	switch(chip_id)
 	{
 		case 0 : cs1_deselect;
@@ -330,6 +612,7 @@ static void deselect_1_chip(uint8_t chip_id)
 		case 2: cs3_deselect;
 				break;
 	}
+#endif
 }
 
 /************************************************************************/
@@ -357,486 +640,1145 @@ static inline uint8_t make_rev_mask(uint8_t bits)
 	return spec_mask;
 }
 
+
 /************************************************************************/
-/* fills page  from given col by pattern                                */
+/* Fills pages with pattern on all chips from chip_mask at once. Chips
+are selected together so every byte is sent only once, chip_mask for
+selecting part 1=left 2=middle 4=right. Only constant fills (clear, fill
+area) are broadcast when drawing directly, same content of images, text
+or lists on several chips is joined only by TG_poll in deferred mode    */
 /************************************************************************/
-static inline void fill_page(const tx_param_st * param)
+static void broadcast_fill(uint8_t chip_mask, uint8_t page, uint8_t pages, uint8_t col, uint8_t size, uint8_t pattern)
 {
-	set_address(param->page,param->col);
-	for (uint8_t i = 0; i < param->bytes_to_send; i++)
-		send_byte(param->offset);
+	if (0 == chip_mask)
+		return;
+	select_chip(chip_mask);
+	while (pages--)
+	{
+		set_address(page++, col);
+		send_pattern(size, pattern);
+	}
+	deselect_chip(chip_mask);
 }
 
-
 /************************************************************************/
-/* Clears selected area by mask bits, invert for Up rows.               */
+/* Returns bits of page covering rows y_min..y_max, 0 when none         */
 /************************************************************************/
-static void clear_page_mask(const tx_param_st * param, uint8_t invert)
+static uint8_t rows_mask(uint8_t page, uint8_t y_min, uint8_t y_max)
+{
+	uint8_t base = (0x07 & ~page) * YPointsPerPage; //row of bit 7
+	if (y_max < base || y_min > base + 7)
+		return 0;
+	uint8_t lo = y_min > base ? y_min - base : 0;
+	uint8_t hi = y_max < base + 7 ? y_max - base : 7;
+	return (uint8_t)((0xFF >> (7 - (hi - lo))) << (7 - hi));
+}
+
+//puts bits of one column into buff, mask selects rows changed by command
+static inline void raster_put(uint8_t * buff, uint8_t mode, uint8_t mask, uint8_t bits)
 {
-	set_address(param->page, param->col);
-	read_data(param->bytes_to_send,page_buff);
-	uint8_t maskUp = make_mask(param->offset);
-	if (invert)
-		maskUp = ~maskUp;
-	for (uint8_t i = 0; i < param->bytes_to_send; i++)
-		page_buff[i] = page_buff[i] & maskUp;
-	set_address(param->page, param->col);
-	send_data(param->bytes_to_send,page_buff);
+	if (RASTER_MASK == mode)
+		*buff |= mask;
+	else
+		*buff = (*buff & ~mask) | (bits & mask);
 }
 
 /************************************************************************/
-/*Clears display in selected rectangle area that starts at
-PointA(posX,posY) and ends at PointB(posX,PosY)						   */
+/* Rasterizes bitmap (pages of bw bytes, LSB at top) placed at (bx,by) into
+columns x..x+size-1 of page, mem tells where bitmap is (IMG_RAM/FLASH)   */
 /************************************************************************/
-void TG_clear_area(uint8_t A_x, uint8_t A_y, uint8_t B_x, uint8_t B_y)
+static void raster_bitmap(uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode,
+	uint8_t bx, uint8_t by, uint8_t bw, uint8_t bh, const uint8_t * img, uint8_t mem)
 {
-	if (A_x >= XPoints || B_x >= XPoints
-	|| A_y >= YPoints || B_y >= YPoints)
-	return;
-	
-	uint8_t set_x, set_y; //coordinates of start point
-	uint8_t end_x, end_y; //coordinates of end point
-	if (A_x > B_x) // sets coordinates for writing to display from left to right;
+	uint8_t mask = rows_mask(page, by, by + bh - 1);
+	uint8_t first = bx > x ? bx : x;
+	uint8_t end = bx + bw < x + size ? bx + bw : x + size;
+	if (0 == mask || first >= end)
+		return;
+	//image row placed at bit 0 of page, negative when page holds top of image
+	int8_t shift = by + bh - YPointsPerPage - (0x07 & ~page) * YPointsPerPage;
+	const uint8_t * src = img + (first - bx);
+	uint8_t next_row = 0; //second image page is needed
+	if (shift >= 0)
 	{
-		set_x = B_x;
-		set_y = B_y;
-		end_x = A_x;
-		end_y = A_y;
+		src += (shift / YPointsPerPage) * bw;
+		next_row = (shift % YPointsPerPage) && shift / YPointsPerPage + 1 < (bh + 7) / YPointsPerPage;
 	}
-	else
-	{
-		set_x = A_x;
-		set_y = A_y;
-		end_x = B_x;
-		end_y = B_y;
-	}
-	uint8_t col_start = set_x%XPointsPerChip;
-	uint8_t page_max = end_y/YPointsPerPage;
-	uint8_t page_min = set_y/YPointsPerPage;
-	uint8_t row_max = (end_y - 1)%YPointsPerPage;
-	uint8_t row_min = set_y%YPointsPerPage;
-	uint8_t page_changes = page_max - page_min + 1;
-	page_max = 0x07 & ~page_max;		//change direction of pages from 7->0, to 0->7
-	
-	tx_info_st tx_info;
-	uint8_t cs_changes = calc_tx_info(set_x,end_x + 1,&tx_info);
-	uint8_t col_set;
-	uint8_t iteration = 0;
-	tx_param_st tx_param;
-	while (cs_changes--)
+	buff += first - x;
+	for (uint8_t col = first; col < end; col++)
 	{
-		if (0 == iteration++)
-		col_set = col_start;
-		else
-		col_set = 0;
-		
-		select_1_chip(tx_info.start_id);
-		for(uint8_t i = 0; i < page_changes; i++)
+		uint8_t bits = 0;
+		if (RASTER_DRAW == mode)
 		{
-			tx_param.bytes_to_send = tx_info.bytes_per_chip[tx_info.start_id];
-			tx_param.col = col_set;
-			tx_param.page = page_max + i;
-			if (0 == i && row_max != 0)
-			{
-				tx_param.offset = row_max;
-				clear_page_mask(&tx_param, true); //reverse mask 
-			}
-			else if (0 == i && row_min != 0)
-			{
-				tx_param.offset = row_min;
-				clear_page_mask(&tx_param, false); //don't reverse mask
-			}
+			if (shift < 0)
+				bits = img_read(src, mem) << -shift;
 			else
 			{
-				tx_param.offset = 0x00; // used as pattern for every byte, not offset!
-				fill_page(&tx_param);
+				bits = img_read(src, mem) >> (shift % YPointsPerPage);
+				if (next_row)
+					bits |= img_read(src + bw, mem) << (YPointsPerPage - shift % YPointsPerPage);
 			}
 		}
-		deselect_1_chip(tx_info.start_id++);
+		raster_put(buff++, mode, mask, bits);
+		src++;
 	}
 }
 
-// used by clearDisplayFull
-static inline void send_pattern(uint8_t size, uint8_t pattern)
+//rasterizes box bw x bh at (bx,by) set, cleared or inverted by fill mode
+static void raster_box(uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode,
+	uint8_t bx, uint8_t by, uint8_t bw, uint8_t bh, uint8_t fill)
 {
-	for (uint8_t i = 0; i < size; i++)
-		send_byte(pattern);
+	uint8_t mask = rows_mask(page, by, by + bh - 1);
+	uint8_t first = bx > x ? bx : x;
+	uint8_t end = bx + bw < x + size ? bx + bw : x + size;
+	if (0 == mask || first >= end)
+		return;
+	if (TG_fill_invert == fill)
+		raster_xor = true;
+	buff += first - x;
+	for (uint8_t col = first; col < end; col++)
+	{
+		uint8_t bits = TG_fill_set == fill ? 0xFF : TG_fill_invert == fill ? ~*buff : 0x00;
+		raster_put(buff++, mode, mask, bits);
+	}
 }
 
-
 /************************************************************************/
-/* Clears full display                                                  */
+/* Rasterizes line from (x,y) to (w,h) of command. Rows of every column
+are the ones integer Bresenham walk gives, error term is computed once
+for first column of span and stepped for the next ones                  */
 /************************************************************************/
-void TG_clear_full(void)
+static void raster_line(const TG_cmd_st * cmd, uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode)
 {
-	uint8_t chip_id = 0;
-	while (chip_id < 3)
+	uint8_t x0 = cmd->x, y0 = cmd->y, x1 = cmd->w, y1 = cmd->h;
+	if (x0 > x1) //draw from left to right
+	{
+		x0 = cmd->w;
+		y0 = cmd->h;
+		x1 = cmd->x;
+		y1 = cmd->y;
+	}
+	uint8_t first = x0 > x ? x0 : x;
+	uint8_t last = x1 < x + size - 1 ? x1 : x + size - 1;
+	if (first > last || 0 == rows_mask(page, y0 < y1 ? y0 : y1, y0 < y1 ? y1 : y0))
+		return;
+	uint8_t dx = x1 - x0;
+	uint8_t dy = y1 > y0 ? y1 - y0 : y0 - y1;
+	uint8_t t = first - x0; //columns from start of line
+	uint16_t err = 0;
+	uint8_t step = 0; //rows passed in current column
+	buff += first - x;
+	if (dx >= dy && dx != 0)
+	{
+		//one row per column, row = round(t * dy / dx)
+		err = 2 * t * dy + dx;
+		step = err / (2 * dx);
+		err %= 2 * dx;
+		for (uint8_t col = first; col <= last; col++)
+		{
+			uint8_t y = y1 > y0 ? y0 + step : y0 - step;
+			uint8_t mask = rows_mask(page, y, y);
+			raster_put(buff++, mode, mask, 0xFF);
+			err += 2 * dy;
+			if (err >= 2 * dx)
+			{
+				err -= 2 * dx;
+				step++;
+			}
+		}
+	}
+	else
 	{
-		select_1_chip(chip_id);
-		for (uint8_t i=0; i < 8; i++)
+		//rows lo..hi of column are those which round(row * dx / dy) gives t
+		uint8_t lo = 0;
+		uint8_t hi = dy;
+		if (dx != 0)
 		{
-			set_address(i,0);
-			send_pattern(XPointsPerChip, 0x0);
+			if (t != 0)
+				lo = (dy * (2 * t - 1) + 2 * dx - 1) / (2 * dx);
+			err = dy * (2 * t + 1) + 2 * dx - 1;
+			step = err / (2 * dx); //first row of next column
+			err %= 2 * dx;
 		}
-		deselect_1_chip(chip_id++);
+		for (uint8_t col = first; col <= last; col++)
+		{
+			if (col != x1)
+				hi = step - 1;
+			else
+				hi = dy;
+			uint8_t mask = y1 > y0 ? rows_mask(page, y0 + lo, y0 + hi) : rows_mask(page, y0 - hi, y0 - lo);
+			raster_put(buff++, mode, mask, 0xFF);
+			if (col == x1)
+				break;
+			lo = step;
+			step += dy / dx;
+			err += (2 * dy) % (2 * dx);
+			if (err >= 2 * dx)
+			{
+				err -= 2 * dx;
+				step++;
+			}
+		}
+	}
+}
+
+//rows of outline x0..x1, y0..y1 in column c of page, corners are cut when rounded
+static uint8_t rect_col_mask(uint8_t page, uint8_t c, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, uint8_t rounded)
+{
+	if (c < x0 || c > x1)
+		return 0;
+	if (rounded && x1 - x0 >= 4 && y1 - y0 >= 4)
+	{
+		if (c == x0 || c == x1)
+			return rows_mask(page, y0 + 2, y1 - 2);
+		if (c == x0 + 1 || c == x1 - 1)
+			return rows_mask(page, y0 + 1, y0 + 1) | rows_mask(page, y1 - 1, y1 - 1);
 	}
+	else if (c == x0 || c == x1)
+		return rows_mask(page, y0, y1);
+	return rows_mask(page, y0, y0) | rows_mask(page, y1, y1);
 }
 
 /************************************************************************/
-/* Changes states for all pixels using XOR operation                     */
+/* Rasterizes rectangle outline of command, vertical edges and both
+horizontal edges of page come in one pass. Double border adds outline
+2 pixels inside                                                         */
 /************************************************************************/
-void TG_reverse_all(void)
+static void raster_rect(const TG_cmd_st * cmd, uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode)
 {
-	for (uint8_t chip = 0; chip < 3; chip++)
+	uint8_t x0 = cmd->x, y0 = cmd->y, x1 = cmd->x + cmd->w, y1 = cmd->y + cmd->h;
+	uint8_t first = x0 > x ? x0 : x;
+	uint8_t last = x1 < x + size - 1 ? x1 : x + size - 1;
+	if (first > last || 0 == rows_mask(page, y0, y1))
+		return;
+	uint8_t rounded = cmd->arg & TG_rect_rounded;
+	uint8_t inner = (cmd->arg & TG_rect_double) && cmd->w >= 4 && cmd->h >= 4;
+	buff += first - x;
+	for (uint8_t col = first; col <= last; col++)
 	{
-		select_1_chip(chip);
-		for (uint8_t page = 0; page < YPoints/YPointsPerPage; page++)
-		{
-			set_address(page, 0);
-			read_data(XPointsPerChip,page_buff);
-			for (uint8_t i = 0; i < XPointsPerChip; i++)
-				page_buff[i] ^= 0xFF;
-			set_address(page,0);
-			for (uint8_t i = 0; i < XPointsPerChip; i++)
-				send_byte(page_buff[i]);
-		}
-		deselect_1_chip(chip);
+		uint8_t mask = rect_col_mask(page, col, x0, y0, x1, y1, rounded);
+		if (inner)
+			mask |= rect_col_mask(page, col, x0 + 2, y0 + 2, x1 - 2, y1 - 2, rounded);
+		raster_put(buff++, mode, mask, 0xFF);
 	}
 }
 
-//Creates images using mask based on bits needed to be cleared, work only on selected rows from up or down (selection by reversing mask)
-static inline void draw_page_mask(const tx_param_st * param, uint8_t rev, const uint8_t * img_ptr)
+#ifdef TG_SHIFTED_FONT
+/************************************************************************/
+/* Rasterizes letter c (32..127) of default font at (bx,by) not aligned to
+page from table shifted at build time, page gets one byte per column and
+mask from table instead of shifted glyph byte                           */
+/************************************************************************/
+static void raster_glyph_shifted(uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode,
+	uint8_t bx, uint8_t by, uint8_t c)
+{
+	uint8_t half; //0 page of top row, 1 page of row by
+	if (page == (0x07 & ~((by + 7) / YPointsPerPage)))
+		half = 0;
+	else if (page == (0x07 & ~(by / YPointsPerPage)))
+		half = 1;
+	else
+		return;
+	uint8_t first = bx > x ? bx : x;
+	uint8_t end = bx + 5 < x + size ? bx + 5 : x + size;
+	if (first >= end)
+		return;
+	uint8_t shift = by % YPointsPerPage - 1;
+	uint8_t mask = TG_READ_BYTE(&default_f_shift_mask[shift][half]);
+	const uint8_t * src = default_f_shift[shift][c - ' '][half] + (first - bx);
+	buff += first - x;
+	for (uint8_t col = first; col < end; col++)
+		raster_put(buff++, mode, mask, RASTER_DRAW == mode ? TG_READ_BYTE(src++) : 0);
+}
+#endif
+
+/************************************************************************/
+/* Returns width of letter c of font and sets letter to its columns (in
+program memory), codes out of font are blank of font width (letter 0)  */
+/************************************************************************/
+static uint8_t font_letter(const TG_font_st * font, char c, const uint8_t ** letter)
 {
-	set_address(param->page, param->col);
-	read_data(param->bytes_to_send,page_buff);
-	uint8_t upper_mask = make_mask(param->offset);
-	if (rev)
-		upper_mask = ~upper_mask;
-	for (uint8_t i = 0; i < param->bytes_to_send; i++)
+	uint8_t code = c;
+	if (code < font->first || code > font->last)
 	{
-		page_buff[i] = page_buff[i] & upper_mask;
-		if (rev)
-			page_buff[i] |= (img_ptr[i] << (8 - param->offset) );
-		else
-			page_buff[i] |= (img_ptr[i] >> param->offset );
+		*letter = 0;
+		return font->width;
+	}
+	code -= font->first;
+	if (0 == font->widths)
+	{
+		*letter = font->bitmap + (uint16_t)code * font->width * font->pages;
+		return font->width;
 	}
-	set_address(param->page, param->col);
-	send_data(param->bytes_to_send,page_buff);
+	*letter = font->bitmap + TG_READ_WORD(&font->offsets[code]);
+	return TG_READ_BYTE(&font->widths[code]);
 }
 
 /************************************************************************/
-/*Creates images using mask based on bits needed to be cleared and pointers
-to last page and page used now, works on all rows*/
+/* Moves position of next letter before drawing c the way TG_printf does:
+letters past top edge are moved down, text wraps at right edge and at new
+line character                                                          */
 /************************************************************************/
-static inline void draw_page(const tx_param_st * param, const uint8_t * img_before_ptr, const uint8_t * img_now_ptr)
+static void text_place(uint8_t * x, uint8_t * y, char c, uint8_t font_width, uint8_t font_height)
 {
-	set_address(param->page, param->col);
-	uint8_t top_mask = make_mask(param->offset);
-	uint8_t bottom_mask;
-	if (param->offset == 0)
-		bottom_mask = 0;
-	else
-		bottom_mask = 8 - param->offset;
-	for (uint8_t i = 0; i < param->bytes_to_send; i++)
+	if (*y + font_height >= YPoints)
+		*y -= (*y + font_height - YPoints);
+	if (*x + font_width >= XPoints || (c == '\n'))
 	{
-		page_buff[i] = (img_now_ptr[i] & ~top_mask) >> bottom_mask;
-		if (param->offset != 0)
-			page_buff[i] |= (img_before_ptr[i] & top_mask) << param->offset;
+		*x = 0;
+		*y -= font_height;
 	}
-	send_data(param->bytes_to_send,page_buff);
 }
 
-/*
-Prints image from buff in given X,Y coordinates with defined sizeX x sizeY image size
-*/
-void TG_image(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * img_ptr)
+/************************************************************************/
+/* Rasterizes every letter of text command placed in columns of span.
+Space between page aligned letters of one line is cleared like TG_printf
+does                                                                    */
+/************************************************************************/
+static void raster_text(const TG_cmd_st * cmd, uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode)
 {
-	if (x + x_size > XPoints || y + y_size> YPoints)
-		return;
-	
-	uint8_t col_start = x%XPointsPerChip;
-	uint8_t page_max = (y + y_size - 1)/YPointsPerPage;
-	uint8_t page_min = y/YPointsPerPage;
-	uint8_t row_max = (y + y_size)%YPointsPerPage;
-	uint8_t row_min = y%YPointsPerPage;
-	uint8_t page_changes = page_max - page_min + 1;
-	page_max = 0x07 & ~page_max;
-	
-	tx_info_st tx_info;
-	uint8_t cs_changes = calc_tx_info(x,x+x_size,&tx_info);
-	uint8_t col_set;
-	uint8_t iteration = 0;
-	
-	uint8_t x_start = 0;
-	uint16_t y_start = 0;
-	tx_param_st TxInfo;
-	while (cs_changes--)
+	const TG_font_st * font = cmd->font;
+	uint8_t height = font->pages * YPointsPerPage;
+	uint8_t tx = cmd->x;
+	uint8_t ty = cmd->y;
+	uint8_t gap_x = 0xFF; //column after last aligned letter
+	uint8_t gap_y = 0xFF;
+	for (const char * txt = cmd->ptr; *txt != '\0'; txt++)
 	{
-		if (0 == iteration++)
-		col_set = col_start;
-		else
-		col_set = 0;
-		
-		select_1_chip(tx_info.start_id);
-		y_start = 0;
-		for(uint8_t i = 0; i < page_changes; i++)
+		const uint8_t * letter;
+		uint8_t width = font_letter(font, *txt, &letter);
+		text_place(&tx, &ty, *txt, width, height);
+		if (ty + height <= YPoints)
 		{
-			TxInfo.bytes_to_send = tx_info.bytes_per_chip[tx_info.start_id];
-			TxInfo.col = col_set;
-			TxInfo.page = page_max + i;
-			TxInfo.offset = row_max;
-			const uint8_t* cur_buff_ptr  = img_ptr + x_start + y_start;
-			if (0 == i && row_max != 0)
-				draw_page_mask(&TxInfo, true, cur_buff_ptr);
-			else if (page_changes - 1 == i && row_min != 0)
-			{
-				TxInfo.offset = row_min;
-				draw_page_mask(&TxInfo, false, cur_buff_ptr - y_size);
-			}
+			if (ty == gap_y && tx == gap_x + cmd->arg)
+				raster_box(page, x, size, buff, mode, gap_x, ty, cmd->arg, height, TG_fill_clear);
+			if (0 == letter)
+				raster_box(page, x, size, buff, mode, tx, ty, width, height, TG_fill_clear);
+#ifdef TG_SHIFTED_FONT
+			else if (ty % YPointsPerPage && &TG_font_default == font)
+				raster_glyph_shifted(page, x, size, buff, mode, tx, ty, *txt);
+#endif
 			else
-				draw_page(&TxInfo, cur_buff_ptr - y_size, cur_buff_ptr);
-			y_start += y_size;
+				raster_bitmap(page, x, size, buff, mode, tx, ty, width, height, letter, IMG_FLASH);
+			gap_x = tx + width;
+			gap_y = 0 == ty % YPointsPerPage ? ty : 0xFF;
 		}
-		deselect_1_chip(tx_info.start_id++);
-		x_start += TxInfo.bytes_to_send;
+		else
+			gap_y = 0xFF;
+		tx += width + cmd->arg;
 	}
 }
 
-typedef struct
+//rasterizes all commands in order into columns x..x+size-1 of page
+static void raster_cmds(const TG_cmd_st * cmd, uint8_t count, uint8_t page, uint8_t x, uint8_t size, uint8_t * buff, uint8_t mode)
 {
-	uint8_t line_type; // if 0 line is more horizontal than vertical, 1 otherwise
-	int8_t y_dir; // 1 when A_posY > B_posY, -1 when A_posY < B_posY, 0 when A_posY == B_posY
-	uint8_t first_seg_len; // how many bits to write first
-	int8_t pixel_changes; //used for counting pixels before change
-	uint8_t row_type_ptr; // used when verHor == 1 (indicates how many writes verticaly) CHANGED!!!! //points which type of row is printing now
-	int8_t row_type_cnt[3]; // 0 left, 1 middle, 2 right
-	uint8_t row_len[2]; // 0 normal, 1 special
-} line_param_st;
+	for (; count; count--, cmd++)
+	{
+		switch (cmd->type)
+		{
+			case CMD_FILL : raster_box(page, x, size, buff, mode, cmd->x, cmd->y, cmd->w, cmd->h, cmd->arg);
+					break;
+			case CMD_IMAGE : raster_bitmap(page, x, size, buff, mode, cmd->x, cmd->y, cmd->w, cmd->h, cmd->ptr, cmd->arg);
+					break;
+			case CMD_LINE : raster_line(cmd, page, x, size, buff, mode);
+					break;
+			case CMD_TEXT : raster_text(cmd, page, x, size, buff, mode);
+					break;
+			case CMD_RECT : raster_rect(cmd, page, x, size, buff, mode);
+					break;
+		}
+	}
+}
 
 /************************************************************************/
-/* draws line horizontally                                              */
+/* Extends box x_min..x_max, y_min..y_max by area command can change    */
 /************************************************************************/
-static inline void draw_hor(tx_param_st * param, line_param_st * step)
+static void cmd_bounds(const TG_cmd_st * cmd, uint8_t * x_min, uint8_t * x_max, uint8_t * y_min, uint8_t * y_max)
 {
-	if (0 == step->y_dir)
+	uint8_t x0 = cmd->x, y0 = cmd->y, x1, y1;
+	if (CMD_LINE == cmd->type)
 	{
-		set_address(param->page, param->col);
-		read_data(param->bytes_to_send, page_buff);
-		for (uint8_t i = 0; i < param->bytes_to_send; i++)
-			page_buff[i] |= (1 << param->offset);
-		set_address(param->page, param->col);
-		send_data(param->bytes_to_send, page_buff);
-		param->col = 0;
+		x1 = cmd->w;
+		y1 = cmd->h;
+		if (x0 > x1)
+		{
+			x0 = cmd->w;
+			x1 = cmd->x;
+		}
+		if (y0 > y1)
+		{
+			y0 = cmd->h;
+			y1 = cmd->y;
+		}
 	}
-	else
+	else if (CMD_TEXT == cmd->type)
 	{
-		uint8_t all_bytes_sent = 0;
-		int8_t rows_checked = param->offset;
-		uint8_t bytes_to_send = param->bytes_to_send;
-		// = step->rowTypePtr;
-		uint8_t bytes_sent = 0;
-		uint8_t bytes_change = 0;
-		uint8_t change = 0; // change from toWrite
-		while (all_bytes_sent < bytes_to_send)
+		//box of all letters drawn, empty (x0 > x1) when none
+		uint8_t height = cmd->font->pages * YPointsPerPage;
+		uint8_t tx = cmd->x;
+		uint8_t ty = cmd->y;
+		x0 = XPoints - 1;
+		y0 = YPoints - 1;
+		x1 = y1 = 0;
+		for (const char * txt = cmd->ptr; *txt != '\0'; txt++)
 		{
-			uint8_t tmp_change = 0;
-			uint8_t type_ptr = step->row_type_ptr;
-			uint8_t row_len;
-			//if ( !(PINC & 1 << 7) && step->firstSegLen != 0)
-				//PORTB ^= 1 << 0;
-			if (0 != step->first_seg_len)
+			const uint8_t * letter;
+			uint8_t width = font_letter(cmd->font, *txt, &letter);
+			text_place(&tx, &ty, *txt, width, height);
+			if (ty + height <= YPoints && width != 0)
 			{
-				all_bytes_sent =step->first_seg_len;
-				rows_checked += step->y_dir;
-				step->first_seg_len = 0;
-				if (step->row_type_cnt[step->row_type_ptr] == 1)
-					type_ptr++;
-				else if (step->row_type_cnt[step->row_type_ptr] > 1)
-				{
-					tmp_change = 1;
-					step->row_type_cnt[step->row_type_ptr]--;
-				}
+				if (tx < x0)
+					x0 = tx;
+				if (tx + width - 1 > x1)
+					x1 = tx + width - 1;
+				if (ty < y0)
+					y0 = ty;
+				if (ty + height - 1 > y1)
+					y1 = ty + height - 1;
 			}
-				//allBytesSent += step->rowLen[ 1 == typePtr ? 0 : 1];
-				
-			while (all_bytes_sent < bytes_to_send)
-			{
-				row_len = step->row_len [ 1 == type_ptr ? 0 : 1];
-				int8_t bytes_to_write = bytes_to_send - all_bytes_sent;
-				change = (bytes_to_write%row_len != 0);
-				//int8_t tmpRowsCheck = rowsCheck;
-				if (1 == step->y_dir)
-				{
-					if (rows_checked + step->row_type_cnt[type_ptr] > 7)
-					{
-						all_bytes_sent += row_len * (8 - rows_checked);
-						rows_checked += (bytes_to_write/row_len + change);
-						break;
-					}
-					else
-					{
-						all_bytes_sent +=	step->row_type_cnt[type_ptr] * row_len;
-						rows_checked += step->row_type_cnt[type_ptr++];
-					}
-				}
-				else // if (-1 == step->ydir)
-				{
-					if (rows_checked - step->row_type_cnt[type_ptr] < 0)
-					{
-						all_bytes_sent += row_len * (rows_checked + 1);
-						rows_checked -= (bytes_to_write/row_len) + change;
-						
-						break;
-					}
-					else
-					{
-						all_bytes_sent +=	step->row_type_cnt[type_ptr] * row_len;
-						rows_checked -= step->row_type_cnt[type_ptr++];
-					}
-				}
-			}
-			if (tmp_change == 1)
-			{
-				step->row_type_cnt[step->row_type_ptr]++;
-				tmp_change = 0;
-			}
-			if (all_bytes_sent >= bytes_to_send)
-			{
-				step->first_seg_len = all_bytes_sent - bytes_to_send;
-				all_bytes_sent = bytes_to_send;
-				//if (step->firstSegLen == 0)
-					//_delay_ms(1000);
-			}
-			bytes_change = all_bytes_sent - bytes_sent;
-			set_address(param->page, param->col);
-			read_data(bytes_change, page_buff);
-			for (uint8_t i = 0; i < bytes_change; i++)
-			{
-				page_buff[i] |= (1 << param->offset);
-				step->pixel_changes--;
-				if (0 >= step->pixel_changes)
-				{
-					step->row_type_cnt[step->row_type_ptr]--;
-					if (0 >= step->row_type_cnt[step->row_type_ptr])
-						step->row_type_ptr++;
-					param->offset += step->y_dir;
-					
-					step->pixel_changes = step->row_len[ 1 == step->row_type_ptr ? 0 : 1 ];
-				}
-			}
-			set_address(param->page,param->col);
-			send_data(bytes_change, page_buff);
-			if (0 > rows_checked && !(change && bytes_to_send == all_bytes_sent))
-			{
-				param->offset = 7;// + (0 == step->pixelsToChange ? 1 : 0);
-				rows_checked = param->offset; //?
-				param->page--;
-			}
-			else if (7 < rows_checked && !(change && bytes_to_send == all_bytes_sent))
-			{
-				param->offset = 0;//  - (0 == step->pixelsToChange ? 1 : 0);
-				rows_checked = param->offset;  //?
-				param->page++;
-			}
-			//param->col += allBytesSent - bytesSent;
-			bytes_sent = all_bytes_sent;
-			param->col = bytes_sent;
-			if (step->first_seg_len > step->row_len[ 1 == step->row_type_ptr ? 0 : 1 ])
-				step->first_seg_len %= step->row_len[ 1 == step->row_type_ptr ? 0 : 1 ];
+			tx += width + cmd->arg;
 		}
-		param->col = 0;
 	}
+	else if (CMD_RECT == cmd->type)
+	{
+		x1 = x0 + cmd->w;
+		y1 = y0 + cmd->h;
+	}
+	else
+	{
+		x1 = x0 + cmd->w - 1;
+		y1 = y0 + cmd->h - 1;
+	}
+	if (x0 < *x_min)
+		*x_min = x0;
+	if (x1 > *x_max)
+		*x_max = x1;
+	if (y0 < *y_min)
+		*y_min = y0;
+	if (y1 > *y_max)
+		*y_max = y1;
 }
 
 /************************************************************************/
-/* draws line vertically                                              */
+/* Draws columns x..x+size-1 of page on selected chip. Columns changed by
+commands are split into runs, every run is read back once (only when some
+bits of it stay), rasterized by all commands and written once           */
 /************************************************************************/
-static inline void draw_ver(tx_param_st * param, line_param_st * step)
+static void draw_list_page(const TG_cmd_st * cmds, uint8_t count, uint8_t page, uint8_t x, uint8_t size)
 {
-	if (1 == param->bytes_to_send) //only true when Ay == By
+	for (uint8_t i = 0; i < size; i++)
+		mask_buff[i] = 0;
+	raster_xor = false;
+	raster_cmds(cmds, count, page, x, size, mask_buff, RASTER_MASK);
+	uint8_t i = 0;
+	while (i < size)
 	{
-		while (0 != step->row_len[0])
+		if (0 == mask_buff[i])
 		{
-			uint8_t data;
-			set_address(param->page, param->col);
-			read_data(1, &data);
-			while (param->offset >= 0 && param->offset <= 7)
-			{
-				data |= (1 << param->offset);
-				param->offset += step->y_dir;
-				step->row_len[0]--;
-				if (0 == step->row_len[0])
-					break;
-			}
-			set_address(param->page,param->col);
-			send_byte(data);
-			if (param->offset < 0)
-			{
-				param->offset = 7;
-				param->page--;
-			}
-			else if (param->offset > 7)
+			i++;
+			continue;
+		}
+		uint8_t start = i;
+		uint8_t end = i;
+		uint8_t read = raster_xor;
+		while (i < size && i - end <= RUN_GAP)
+		{
+			if (mask_buff[i])
+				end = i + 1;
+			i++;
+		}
+		for (uint8_t j = start; j < end; j++)
+			if (mask_buff[j] != 0xFF)
+				read = true;
+		uint8_t col = (x + start) % XPointsPerChip;
+		if (read)
+		{
+			set_address(page, col);
+			read_data(end - start, page_buff + start);
+		}
+		raster_cmds(cmds, count, page, x + start, end - start, page_buff + start, RASTER_DRAW);
+		set_address(page, col);
+		send_data(end - start, page_buff + start);
+	}
+}
+
+/************************************************************************/
+/* Chooses page order of list. Span of rising line in upper page starts at
+column where its span in lower page ended, so drawing from bottom page
+leaves column counter there and column commands are skipped. Falling
+lines profit from top to bottom order the same way, other commands don't
+depend on order. Returns true when rising lines are majority            */
+/************************************************************************/
+static uint8_t lines_rise(const TG_cmd_st * cmds, uint8_t count)
+{
+	int16_t rising = 0;
+	for (uint8_t i = 0; i < count; i++, cmds++)
+	{
+		if (CMD_LINE != cmds->type || cmds->x == cmds->w || cmds->y == cmds->h)
+			continue;
+		rising += (cmds->x < cmds->w) == (cmds->y < cmds->h) ? 1 : -1;
+	}
+	return rising > 0;
+}
+
+/************************************************************************/
+/* Draws recorded commands page by page and chip by chip, pages from top
+or from bottom (lines_rise)                                             */
+/************************************************************************/
+static void draw_list(const TG_cmd_st * cmds, uint8_t count)
+{
+	if (0 == count)
+		return;
+	uint8_t x_min = XPoints - 1, x_max = 0, y_min = YPoints - 1, y_max = 0;
+	for (uint8_t i = 0; i < count; i++)
+		cmd_bounds(&cmds[i], &x_min, &x_max, &y_min, &y_max);
+	if (x_min > x_max || y_min > y_max)
+		return;
+	uint8_t page = 0x07 & ~(y_max / YPointsPerPage);
+	uint8_t page_end = 0x07 & ~(y_min / YPointsPerPage);
+	int8_t page_step = 1;
+	if (lines_rise(cmds, count))
+	{
+		page_end = page;
+		page = 0x07 & ~(y_min / YPointsPerPage);
+		page_step = -1;
+	}
+	for (;; page += page_step)
+	{
+		for (uint8_t chip = x_min / XPointsPerChip; chip <= x_max / XPointsPerChip; chip++)
+		{
+			uint8_t first = chip * XPointsPerChip;
+			uint8_t last = first + XPointsPerChip - 1;
+			if (x_min > first)
+				first = x_min;
+			if (x_max < last)
+				last = x_max;
+			select_1_chip(chip);
+			draw_list_page(cmds, count, page, first, last - first + 1);
+			deselect_1_chip(chip);
+		}
+		if (page == page_end)
+			break;
+	}
+}
+
+/************************************************************************/
+/* Draws commands recorded into open display list before function which
+can't be recorded, so result is the same as when drawing directly      */
+/************************************************************************/
+static void list_flush(void)
+{
+	if (0 == list_size)
+		return;
+	draw_list(list_buff, list_count);
+	list_count = 0;
+}
+
+/************************************************************************/
+/* Records command when display list is open, full list is drawn first.
+Returns false when command has to be drawn directly                     */
+/************************************************************************/
+static uint8_t list_record(uint8_t type, uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t arg, const void * ptr)
+{
+	if (0 == list_size)
+		return false;
+	if (list_count == list_size)
+		list_flush();
+	TG_cmd_st * cmd = &list_buff[list_count++];
+	cmd->type = type;
+	cmd->x = x;
+	cmd->y = y;
+	cmd->w = w;
+	cmd->h = h;
+	cmd->arg = arg;
+	cmd->ptr = ptr;
+	return true;
+}
+
+/************************************************************************/
+/* Draws recorded commands and goes back to drawing directly            */
+/************************************************************************/
+static void list_end(void)
+{
+	uint8_t count = list_count;
+	list_count = 0;
+	list_size = 0; //functions called from here draw directly
+	draw_list(list_buff, count);
+}
+
+void TG_list_end(void)
+{
+	STAT_BEGIN(TG_stat_list_end);
+	list_end();
+	STAT_END(TG_stat_list_end);
+}
+
+/************************************************************************/
+/* Starts recording of drawing functions into list of size commands    */
+/************************************************************************/
+void TG_list_begin(TG_cmd_st * list, uint8_t size)
+{
+	list_end();
+	list_buff = list;
+	list_size = size;
+	list_count = 0;
+}
+
+/************************************************************************/
+/* Fills rows of mask in size columns of page on selected chip, page is
+read back only when some of its bits stay                               */
+/************************************************************************/
+static void fill_span(uint8_t page, uint8_t col, uint8_t size, uint8_t mask, uint8_t mode)
+{
+	set_address(page, col);
+	if (0xFF == mask && TG_fill_invert != mode)
+	{
+		send_pattern(size, TG_fill_set == mode ? 0xFF : 0x00);
+		return;
+	}
+	read_data(size, page_buff);
+	for (uint8_t i = 0; i < size; i++)
+	{
+		if (TG_fill_invert == mode)
+			page_buff[i] ^= mask;
+		else if (TG_fill_set == mode)
+			page_buff[i] |= mask;
+		else
+			page_buff[i] &= ~mask;
+	}
+	set_address(page, col);
+	send_data(size, page_buff);
+}
+
+/************************************************************************/
+/* Sets, clears or inverts box of w x h pixels from (x,y). Inner pages are
+written without read-back, pages of chips filled on whole width are sent
+to these chips together                                                 */
+/************************************************************************/
+static void fill_area(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t mode)
+{
+	if (0 == w || 0 == h || x + w > XPoints || y + h > YPoints || mode > TG_fill_invert)
+		return;
+	if (list_record(CMD_FILL, x, y, w, h, mode, 0))
+		return;
+	uint8_t top = y + h - 1;
+	uint8_t page_first = 0x07 & ~(top / YPointsPerPage);
+	uint8_t page_last = 0x07 & ~(y / YPointsPerPage);
+	uint8_t mask_first = rows_mask(page_first, y, top);
+	uint8_t mask_last = rows_mask(page_last, y, top);
+	
+	tx_info_st tx_info;
+	uint8_t cs_changes = calc_tx_info(x, x + w, &tx_info);
+	uint8_t col = x % XPointsPerChip;
+	uint8_t full_chips = 0; //chips filled on whole width, their inner pages are filled together
+	while (cs_changes--)
+	{
+		uint8_t size = tx_info.bytes_per_chip[tx_info.start_id];
+		uint8_t full_chip = (TG_fill_invert != mode && XPointsPerChip == size);
+		if (full_chip)
+			full_chips |= HIGH << tx_info.start_id;
+		select_1_chip(tx_info.start_id);
+		for (uint8_t page = page_first; page <= page_last; page++)
+		{
+			uint8_t mask = rows_mask(page, y, top);
+			if (!full_chip || mask != 0xFF)
+				fill_span(page, col, size, mask, mode);
+		}
+		deselect_1_chip(tx_info.start_id++);
+		col = 0;
+	}
+	uint8_t first_full = page_first + (mask_first != 0xFF);
+	int8_t full_pages = page_last - first_full + 1 - (page_last != page_first && mask_last != 0xFF);
+	if (full_pages > 0)
+		broadcast_fill(full_chips, first_full, full_pages, 0, XPointsPerChip, TG_fill_set == mode ? 0xFF : 0x00);
+}
+
+void TG_fill_area(uint8_t x, uint8_t y, uint8_t w, uint8_t h, uint8_t mode)
+{
+	STAT_BEGIN(TG_stat_fill_area);
+	fill_area(x, y, w, h, mode);
+	STAT_END(TG_stat_fill_area);
+}
+
+/************************************************************************/
+/*Clears display in selected rectangle area that starts at
+PointA(posX,posY) and ends at PointB(posX,PosY), both inclusive         */
+/************************************************************************/
+void TG_clear_area(uint8_t A_x, uint8_t A_y, uint8_t B_x, uint8_t B_y)
+{
+	STAT_BEGIN(TG_stat_clear_area);
+	if (A_x >= XPoints || B_x >= XPoints
+	|| A_y >= YPoints || B_y >= YPoints)
+		STAT_RETURN(TG_stat_clear_area);
+	uint8_t x_min = A_x < B_x ? A_x : B_x;
+	uint8_t y_min = A_y < B_y ? A_y : B_y;
+	fill_area(x_min, y_min, (A_x < B_x ? B_x : A_x) - x_min + 1, (A_y < B_y ? B_y : A_y) - y_min + 1, TG_fill_clear);
+	STAT_END(TG_stat_clear_area);
+}
+
+/************************************************************************/
+/* Clears full display                                                  */
+/************************************************************************/
+static void clear_full(void)
+{
+	if (list_record(CMD_FILL, 0, 0, XPoints, YPoints, TG_fill_clear, 0))
+		return;
+	broadcast_fill(TG_left_disp | TG_mid_disp | TG_right_disp, 0, YPoints/YPointsPerPage, 0, XPointsPerChip, 0x0);
+}
+
+void TG_clear_full(void)
+{
+	STAT_BEGIN(TG_stat_clear_full);
+	clear_full();
+	STAT_END(TG_stat_clear_full);
+}
+
+#ifdef TG_DEFERRED_FLUSH
+//checks if column of dirty map is changed
+#define dirty_col(map, col) ((map)[(col) / 8] & (HIGH << ((col) % 8)))
+
+//checks if some of columns start..end-1 of dirty map are changed
+static uint8_t dirty_cols(const uint8_t * map, uint8_t start, uint8_t end)
+{
+	for (uint8_t col = start; col < end; col++)
+		if (dirty_col(map, col))
+			return true;
+	return false;
+}
+
+//marks columns start..end-1 of dirty map clean
+static void clean_cols(uint8_t * map, uint8_t start, uint8_t end)
+{
+	for (uint8_t col = start; col < end; col++)
+		map[col / 8] &= ~(HIGH << (col % 8));
+}
+
+//marks columns start..end-1 of dirty map changed
+static void dirty_cols_set(uint8_t * map, uint8_t start, uint8_t end)
+{
+	for (uint8_t col = start; col < end; col++)
+		map[col / 8] |= HIGH << (col % 8);
+}
+
+/************************************************************************/
+/* Takes first run of changed columns of page on chip from column from on
+and marks it clean.
+Unchanged columns between changes are rewritten only when it costs less
+than new column address (TG_COST_CMD, TG_COST_DATA). Other chips with
+changes in the same columns and the same bytes there join the run.
+Returns chips of run, 0 when page of chip is clean                      */
+/************************************************************************/
+static uint8_t take_dirty_run(uint8_t page, uint8_t chip, uint8_t from, uint8_t * start_ptr, uint8_t * end_ptr)
+{
+	uint8_t * map = dirty[chip][page];
+	uint8_t start = from;
+	while (start < XPointsPerChip && !dirty_col(map, start))
+		start = (map[start / 8] >> (start % 8)) ? start + 1 : (start | 0x07) + 1; //skips clean bytes
+	if (XPointsPerChip == start)
+		return 0;
+	uint8_t end = start + 1;
+	uint8_t gap = 0;
+	for (uint8_t col = end; col < XPointsPerChip; col++)
+	{
+		if (dirty_col(map, col))
+		{
+			end = col + 1;
+			gap = 0;
+		}
+		else if (++gap * TG_COST_DATA > TG_COST_CMD)
+			break;
+	}
+	clean_cols(map, start, end);
+	uint8_t chip_mask = HIGH << chip;
+	for (uint8_t other = chip + 1; other < 3; other++)
+	{
+		if (!dirty_cols(dirty[other][page], start, end)
+			|| !shadow_equal(chip_mask | (HIGH << other), page, start, end))
+			continue;
+		clean_cols(dirty[other][page], start, end);
+		chip_mask |= HIGH << other;
+	}
+	*start_ptr = start;
+	*end_ptr = end;
+	return chip_mask;
+}
+
+/************************************************************************/
+/* Drops chips from run being sent whose shadow differs from first chip of
+run in next size columns. Equality is checked by take_dirty_run, but run
+may be sent by several TG_poll calls with drawing between them. Rest of
+run of dropped chip is marked changed again                             */
+/************************************************************************/
+static void check_run_chips(uint8_t size)
+{
+	uint8_t first = 0;
+	while (!(flush_chips & (HIGH << first)))
+		first++;
+	for (uint8_t chip = first + 1; chip < 3; chip++)
+	{
+		if (!(flush_chips & (HIGH << chip))
+			|| shadow_equal((HIGH << first) | (HIGH << chip), flush_page, flush_col, flush_col + size))
+			continue;
+		flush_chips &= ~(HIGH << chip);
+		dirty_cols_set(dirty[chip][flush_page], flush_col, flush_end);
+	}
+}
+
+//sends start line changed by TG_scroll_v
+static void send_start_line(void)
+{
+	start_line_pending = false;
+	set_start_line(start_line, TG_left_disp | TG_mid_disp | TG_right_disp);
+}
+
+/************************************************************************/
+/* Finds next changed run for TG_poll from scan position on. Pages of chips
+are scanned in order and scan wraps to first page after last one, so pages
+drawn all the time can't hold back the other ones. Waiting start line is
+sent before first run past its place after wrap, everything changed before
+scroll is sent then. Returns false when all pages are clean             */
+/************************************************************************/
+static uint8_t next_dirty_run(void)
+{
+	//page of scan position is visited again from column 0 after wrap
+	for (uint8_t visit = 0; visit <= SCAN_END / XPointsPerChip; visit++)
+	{
+		if (SCAN_END == scan_pos)
+		{
+			scan_pos = 0;
+			if (START_POS == start_line_pending) //came round without change past its place
+				send_start_line();
+			else if (start_line_pending)
+				start_line_pending = START_POS;
+		}
+		uint8_t slot = scan_pos / XPointsPerChip;
+		flush_chips = take_dirty_run(slot / 3, slot % 3, scan_pos % XPointsPerChip, &flush_col, &flush_end);
+		if (flush_chips)
+		{
+			flush_page = slot / 3;
+			if (START_POS == start_line_pending && slot * XPointsPerChip + flush_col >= start_line_pos)
+				send_start_line();
+			scan_pos = slot * XPointsPerChip + flush_end;
+			return true;
+		}
+		scan_pos = (slot + 1) * XPointsPerChip;
+	}
+	scan_pos = 0; //next changes are sent from first page
+	return false;
+}
+#endif
+
+/************************************************************************/
+/* Sends at most max_bytes of changed data to display, returns true when
+display shows everything drawn                                          */
+/************************************************************************/
+static uint8_t poll(uint8_t max_bytes)
+{
+#ifdef TG_DEFERRED_FLUSH
+	for (;;)
+	{
+		if (0 == flush_chips && !next_dirty_run())
+		{
+			if (start_line_pending)
+				send_start_line();
+			if (flush_pending)
 			{
-				param->offset = 0;
-				param->page++;
+				flush_pending = false;
+				if (flush_callback)
+					flush_callback();
 			}
+			return true;
 		}
+		if (0 == max_bytes)
+			return false;
+		uint8_t size = flush_end - flush_col;
+		if (size > max_bytes)
+			size = max_bytes;
+		max_bytes -= size;
+		if (flush_chips & (flush_chips - 1)) //run joins several chips
+			check_run_chips(size);
+		uint8_t chip = 0;
+		while (!(flush_chips & (HIGH << chip)))
+			chip++;
+		const uint8_t * src = &shadow[chip][flush_page][flush_col];
+		bus_select(flush_chips);
+		send_address(flush_page, flush_col);
+		advance_col(size);
+		flush_col += size;
+		stat_add(data_written, size);
+		while (size--)
+			send_byte(*src++);
+		bus_deselect(flush_chips);
+		if (flush_col == flush_end)
+			flush_chips = 0;
 	}
-	else
+#else
+	(void)max_bytes;
+	return true;
+#endif
+}
+
+uint8_t TG_poll(uint8_t max_bytes)
+{
+	STAT_BEGIN(TG_stat_poll);
+	uint8_t done = poll(max_bytes);
+	STAT_END(TG_stat_poll);
+	return done;
+}
+
+/************************************************************************/
+/* Sends changed part of every page to display, one run per page and chip */
+/************************************************************************/
+static void flush(void)
+{
+	while (!poll(XPointsPerChip));
+}
+
+void TG_flush(void)
+{
+	STAT_BEGIN(TG_stat_flush);
+	flush();
+	STAT_END(TG_stat_flush);
+}
+
+/*
+Initializes ports for work with display
+*/
+void TG_init(void)
+{
+	STAT_BEGIN(TG_stat_init);
+	//initialize MCU interface
+	TG_BUS_INIT();
+	
+	//initialize display
+	addr_page_valid = 0;
+	addr_col_valid = 0;
+	strobe_reset;
+	set_type_data;
+	set_state_write;
+	DELAY_MS(35);
+	chip_command(0x3F, 0x7);
+	set_start_line(0,0x7);
+	cs1_deselect;
+	cs2_deselect;
+	cs3_deselect;
+#ifdef TG_SHADOW_BUFFER
+	clear_full(); //display RAM has to match shadow
+	flush();
+#endif
+	STAT_END(TG_stat_init);
+}
+
+/************************************************************************/
+/* Sets function called by TG_poll when display shows everything drawn  */
+/************************************************************************/
+void TG_set_flush_callback(void (*callback)(void))
+{
+#ifdef TG_DEFERRED_FLUSH
+	flush_callback = callback;
+#else
+	(void)callback;
+#endif
+}
+
+/************************************************************************/
+/* Changes states of pixels in box w x h from (x,y) using XOR, every page
+of chip is read and written once, edge pages only in rows of box        */
+/************************************************************************/
+void TG_reverse_area(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+	STAT_BEGIN(TG_stat_reverse_area);
+	fill_area(x, y, w, h, TG_fill_invert);
+	STAT_END(TG_stat_reverse_area);
+}
+
+/************************************************************************/
+/* Changes states for all pixels using XOR operation                     */
+/************************************************************************/
+void TG_reverse_all(void)
+{
+	STAT_BEGIN(TG_stat_reverse_all);
+	fill_area(0, 0, XPoints, YPoints, TG_fill_invert);
+	STAT_END(TG_stat_reverse_all);
+}
+
+/*
+Prints image from buff in given X,Y coordinates with defined sizeX x sizeY image size
+*/
+void TG_image(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * img_ptr)
+{
+	STAT_BEGIN(TG_stat_image);
+	if (x + x_size > XPoints || y + y_size> YPoints || 0 == x_size || 0 == y_size)
+		STAT_RETURN(TG_stat_image);
+	if (list_record(CMD_IMAGE, x, y, x_size, y_size, IMG_RAM, img_ptr))
+		STAT_RETURN(TG_stat_image);
+	TG_cmd_st cmd = {CMD_IMAGE, x, y, x_size, y_size, IMG_RAM, img_ptr, 0};
+	draw_list(&cmd, 1);
+	STAT_END(TG_stat_image);
+}
+
+/*
+Prints image placed in program memory (TG_PROGMEM) like TG_image
+*/
+void TG_image_P(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * img_ptr)
+{
+	STAT_BEGIN(TG_stat_image_P);
+	if (x + x_size > XPoints || y + y_size> YPoints || 0 == x_size || 0 == y_size)
+		STAT_RETURN(TG_stat_image_P);
+	if (list_record(CMD_IMAGE, x, y, x_size, y_size, IMG_FLASH, img_ptr))
+		STAT_RETURN(TG_stat_image_P);
+	TG_cmd_st cmd = {CMD_IMAGE, x, y, x_size, y_size, IMG_FLASH, img_ptr, 0};
+	draw_list(&cmd, 1);
+	STAT_END(TG_stat_image_P);
+}
+
+//state of decoder of TG_image_rle data
+typedef struct
+{
+	const uint8_t * src;
+	uint8_t count; //bytes left in current block
+	uint8_t repeat; //block repeats one byte
+} rle_st;
+
+/************************************************************************/
+/* Returns next image byte of run-length data in program memory. Block
+starts with byte n, n < 128 is followed by n + 1 bytes to copy, n >= 128
+by one byte repeated n - 127 times                                       */
+/************************************************************************/
+static uint8_t rle_next(rle_st * rle)
+{
+	if (0 == rle->count)
+	{
+		uint8_t head = TG_READ_BYTE(rle->src++);
+		rle->repeat = head & 0x80;
+		rle->count = (head & 0x7F) + 1;
+	}
+	rle->count--;
+	uint8_t byte = TG_READ_BYTE(rle->src);
+	if (!rle->repeat || 0 == rle->count)
+		rle->src++;
+	return byte;
+}
+
+/*
+Prints image compressed with run-length coding (tools/TG19264Conv.c) like
+TG_image_P. Image is decoded page by page and chip by chip straight into
+page_buff, image rows shared by 2 pages are decoded by second decoder
+*/
+void TG_image_rle(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, const uint8_t * rle_ptr)
+{
+	STAT_BEGIN(TG_stat_image_rle);
+	if (x + x_size > XPoints || y + y_size > YPoints || 0 == x_size || 0 == y_size)
+		STAT_RETURN(TG_stat_image_rle);
+	list_flush(); //data can be decoded only in order, recorded commands go first
+	uint8_t top = y + y_size - 1;
+	uint8_t rows = (y_size + YPointsPerPage - 1) / YPointsPerPage; //pages of image data
+	int8_t shift = top % YPointsPerPage - 7; //image row placed at bit 0 of page, negative for top page
+	rle_st row = {rle_ptr, 0, 0}; //start of image row of page
+	rle_st next = row; //start of following image row
+	uint8_t page_end = 0x07 & ~(y / YPointsPerPage);
+	for (uint8_t page = 0x07 & ~(top / YPointsPerPage); ; page++)
 	{
-		uint8_t row_len = step->row_len[ 1 == step->row_type_ptr ? 0 : 1];
-		uint8_t bytes_sent = 0;
-		while (bytes_sent < param->bytes_to_send)
+		uint8_t mask = rows_mask(page, y, top);
+		uint8_t bit = shift < 0 ? 0 : shift % YPointsPerPage;
+		uint8_t two_rows = bit && shift / YPointsPerPage + 1 < rows;
+		rle_st low = row;
+		rle_st high = next;
+		for (uint8_t chip = x / XPointsPerChip; chip <= (x + x_size - 1) / XPointsPerChip; chip++)
 		{
-			uint8_t data;
-			set_address(param->page, param->col);
-			read_data(1,&data);
-			while(param->offset >= 0 && param->offset <= 7 && row_len != 0)
+			uint8_t first = chip * XPointsPerChip > x ? chip * XPointsPerChip : x;
+			uint8_t end = (chip + 1) * XPointsPerChip < x + x_size ? (chip + 1) * XPointsPerChip : x + x_size;
+			uint8_t size = end - first;
+			select_1_chip(chip);
+			if (mask != 0xFF)
 			{
-				data |= (1 << param->offset);
-				param->offset += step->y_dir;
-				row_len--;
+				set_address(page, first % XPointsPerChip);
+				read_data(size, page_buff);
 			}
-			set_address(param->page, param->col);
-			send_byte(data);
-			if (0 == row_len)
+			for (uint8_t i = 0; i < size; i++)
 			{
-				step->row_type_cnt[step->row_type_ptr]--;
-				bytes_sent++;
-				param->col++;
-				if (0 == step->row_type_cnt[step->row_type_ptr])
+				uint8_t bits;
+				if (shift < 0)
+					bits = rle_next(&low) << -shift;
+				else
 				{
-					step->row_type_ptr++;
-					if (step->row_type_ptr > 2)
-						break;
+					bits = rle_next(&low) >> bit;
+					if (two_rows)
+						bits |= rle_next(&high) << (YPointsPerPage - bit);
 				}
-				if (step->row_type_cnt[step->row_type_ptr] > 0)
-					row_len = step->row_len[1 == step->row_type_ptr ? 0 : 1];
-			}
-			if (param->offset < 0)
-			{
-				param->offset = 7;
-				param->page--;
-			}
-			else if (param->offset > 7)
-			{
-				param->offset = 0;
-				param->page++;
+				page_buff[i] = (page_buff[i] & ~mask) | (bits & mask);
 			}
+			set_address(page, first % XPointsPerChip);
+			send_data(size, page_buff);
+			deselect_1_chip(chip);
 		}
-		param->col = 0;
+		if (page == page_end)
+			break;
+		if (shift < 0)
+			next = low; //top row is needed again by next page
+		else if (two_rows)
+		{
+			row = next;
+			next = high;
+		}
+		else
+			row = low;
+		shift += YPointsPerPage;
 	}
+	STAT_END(TG_stat_image_rle);
 }
 
-/************************************************************************/
-/* Draws line on given chip display using drawVer() and drawHor() fun   */
-/************************************************************************/
-static inline void line_select_fun(tx_param_st * tx_param, line_param_st * line_param )
+/*
+Shows frame of whole display (TG_image layout, 192 x 64). With shadow
+buffer only bytes differing from it are written, unchanged bytes between
+changed ones are rewritten when it costs less than new column address
+(TG_COST_DATA, TG_COST_CMD). Without shadow buffer every page is written
+*/
+void TG_present(const uint8_t * frame)
 {
-	if (line_param->line_type)
-		draw_ver(tx_param, line_param);
-	else
-		draw_hor(tx_param, line_param);
+	STAT_BEGIN(TG_stat_present);
+	list_flush();
+	for (uint8_t chip = 0; chip < 3; chip++)
+	{
+		select_1_chip(chip);
+		for (uint8_t page = 0; page < YPoints / YPointsPerPage; page++)
+		{
+			const uint8_t * src = frame + page * XPoints + chip * XPointsPerChip;
+#ifdef TG_SHADOW_BUFFER
+			const uint8_t * old = shadow[chip][0x07 & (page + start_line / YPointsPerPage)];
+			uint8_t col = 0;
+			while (col < XPointsPerChip)
+			{
+				if (src[col] == old[col])
+				{
+					col++;
+					continue;
+				}
+				uint8_t start = col++;
+				uint8_t end = col;
+				uint8_t gap = 0; //unchanged bytes after end
+				while (col < XPointsPerChip)
+				{
+					if (src[col] != old[col])
+					{
+						end = col + 1;
+						gap = 0;
+					}
+					else if (++gap * TG_COST_DATA > TG_COST_CMD)
+						break;
+					col++;
+				}
+				set_address(page, start);
+				send_data(end - start, src + start);
+			}
+#else
+			set_address(page, 0);
+			send_data(XPointsPerChip, src);
+#endif
+		}
+		deselect_1_chip(chip);
+	}
+	STAT_END(TG_stat_present);
 }
 
 /*
@@ -844,127 +1786,289 @@ Draws line from pointA to pointB
 */
 void TG_line(uint8_t A_x, uint8_t A_y, uint8_t B_x, uint8_t B_y)
 {
+	STAT_BEGIN(TG_stat_line);
 	//if values above max value, don't execute cmd
 	if (A_x >= XPoints || B_x >= XPoints
 		|| A_y >= YPoints || B_y >= YPoints)
-		return;
-	
-	uint8_t set_x, set_y; //coordinates of start point
-	uint8_t end_x, end_y; //coordinates of end point
-	if (A_x > B_x) // sets coordinates for writing to display from left to right;
-	{
-		set_x = B_x;
-		set_y = B_y;
-		end_x = A_x;
-		end_y = A_y;
-	}
-	else
-	{
-		set_x = A_x;
-		set_y = A_y;
-		end_x = B_x;
-		end_y = B_y;
-	}
-	
-	line_param_st line_param;
-	//check direction of writing pages, -1 => form 0 ~ 7 if 1 => from 7 ~ 0, if 0 don't change;
-	line_param.y_dir = end_y - set_y ? (end_y - set_y < 0) ? 1 : -1 : 0; // if endY == setY yDir = 0, else if result negative yDir = 1, else yDir = -1
-	uint8_t dots_x = end_x - set_x + 1;
-	int8_t dots_y = end_y - set_y;
-	if (dots_y < 0)
-		dots_y  = -1 * dots_y;
-	dots_y++;
-	if (dots_y > dots_x)
-	{
-		line_param.row_len[0] = dots_y / dots_x;
-		line_param.row_len[1] = line_param.row_len[0] + 1;
-		line_param.row_type_cnt[0] = line_param.row_type_cnt[2] = (dots_y % dots_x) / 2;
-		if ( (dots_y % dots_x) % 2 != 0)
-			line_param.row_type_cnt[2]++;
-		if (0 != line_param.row_type_cnt[0])
-			line_param.row_type_ptr = 0;
-		else
-			line_param.row_type_ptr = 1;
-		line_param.row_type_cnt[1] = dots_x - line_param.row_type_cnt[0] - line_param.row_type_cnt[2];
-		line_param.line_type = 1;
-	}
-	else
-	{
-		line_param.row_len[0] = dots_x / dots_y;
-		line_param.row_len[1] = line_param.row_len[0] + 1;
-		line_param.row_type_cnt[0] = (dots_x % dots_y) / 2;
-		line_param.row_type_cnt[2] = (dots_x % dots_y) / 2;
-		if ( (dots_x % dots_y) % 2 != 0)
-			line_param.row_type_cnt[2]++;
-		if (0 != line_param.row_type_cnt[0])
-			line_param.row_type_ptr = 0;
-		else
-			line_param.row_type_ptr = 1;
-		line_param.row_type_cnt[1] = dots_y - line_param.row_type_cnt[0] - line_param.row_type_cnt[2];
-		line_param.line_type = 0;
-	}
-	line_param.first_seg_len = 1 == line_param.row_type_ptr ? line_param.row_len[0] : line_param.row_len[1]; //if special rows, write special pixels length else normal length
-	line_param.pixel_changes = line_param.first_seg_len;
-	//gets information about chipID write sequence
+		STAT_RETURN(TG_stat_line);
+	if (list_record(CMD_LINE, A_x, A_y, B_x, B_y, 0, 0))
+		STAT_RETURN(TG_stat_line);
+	TG_cmd_st cmd = {CMD_LINE, A_x, A_y, B_x, B_y, 0, 0, 0};
+	draw_list(&cmd, 1);
+	STAT_END(TG_stat_line);
+}
+
+
+/************************************************************************/
+/* Draws horizontal line of length pixels from (x,y) to the right, line
+is read back and written once per chip                                  */
+/************************************************************************/
+void TG_hline(uint8_t x, uint8_t y, uint8_t length)
+{
+	STAT_BEGIN(TG_stat_hline);
+	if (0 == length || x + length > XPoints || y >= YPoints)
+		STAT_RETURN(TG_stat_hline);
+	if (list_record(CMD_FILL, x, y, length, 1, TG_fill_set, 0))
+		STAT_RETURN(TG_stat_hline);
+	uint8_t page = 0x07 & ~(y / YPointsPerPage);
+	uint8_t bit = rows_mask(page, y, y);
 	tx_info_st tx_info;
-	end_x++;
-	uint8_t cs_changes = calc_tx_info(set_x,end_x, &tx_info);
-	end_x--; //refactor
-	tx_param_st txInfo; //offset used for row number
-	txInfo.offset = set_y % YPointsPerPage;
-	txInfo.offset = 0x7 & ~txInfo.offset;
-	txInfo.page = set_y / YPointsPerPage;
-	txInfo.page = 0x07 & ~txInfo.page;		//change direction of pages from 7->0, to 0->7
-	txInfo.col = set_x % XPointsPerChip;
+	uint8_t cs_changes = calc_tx_info(x, x + length, &tx_info);
+	uint8_t col = x % XPointsPerChip;
 	while (cs_changes--)
 	{
-		txInfo.bytes_to_send = tx_info.bytes_per_chip[tx_info.start_id];
+		uint8_t size = tx_info.bytes_per_chip[tx_info.start_id];
 		select_1_chip(tx_info.start_id);
-		line_select_fun(&txInfo,&line_param);
+		set_address(page, col);
+		read_data(size, page_buff);
+		for (uint8_t i = 0; i < size; i++)
+			page_buff[i] |= bit;
+		set_address(page, col);
+		send_data(size, page_buff);
 		deselect_1_chip(tx_info.start_id++);
+		col = 0;
+	}
+	STAT_END(TG_stat_hline);
+}
+
+/************************************************************************/
+/* Draws vertical line of length pixels from (x,y) up. Pages covered
+fully get 0xFF without reading, only edge pages are read back           */
+/************************************************************************/
+void TG_vline(uint8_t x, uint8_t y, uint8_t length)
+{
+	STAT_BEGIN(TG_stat_vline);
+	if (0 == length || x >= XPoints || y + length > YPoints)
+		STAT_RETURN(TG_stat_vline);
+	if (list_record(CMD_FILL, x, y, 1, length, TG_fill_set, 0))
+		STAT_RETURN(TG_stat_vline);
+	uint8_t top = y + length - 1;
+	uint8_t col = x % XPointsPerChip;
+	uint8_t page_end = 0x07 & ~(y / YPointsPerPage);
+	select_1_chip(x / XPointsPerChip);
+	for (uint8_t page = 0x07 & ~(top / YPointsPerPage); page <= page_end; page++)
+	{
+		uint8_t bits = rows_mask(page, y, top);
+		if (bits != 0xFF)
+		{
+			set_address(page, col);
+			read_data(1, page_buff);
+			bits |= page_buff[0];
+		}
+		set_address(page, col);
+		send_data_byte(bits);
 	}
+	deselect_1_chip(x / XPointsPerChip);
+	STAT_END(TG_stat_vline);
 }
 
+/************************************************************************/
+/* Draws rectangle outline with style, every touched part of page is read
+back and written once per chip                                          */
+/************************************************************************/
+static void rectangle_style(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, uint8_t style)
+{
+	if (x + x_size >= XPoints || y + y_size >= YPoints)
+		return;
+	if (list_record(CMD_RECT, x, y, x_size, y_size, style, 0))
+		return;
+	TG_cmd_st cmd = {CMD_RECT, x, y, x_size, y_size, style, 0, 0};
+	draw_list(&cmd, 1);
+}
+
+void TG_rectangle_style(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size, uint8_t style)
+{
+	STAT_BEGIN(TG_stat_rectangle_style);
+	rectangle_style(x, y, x_size, y_size, style);
+	STAT_END(TG_stat_rectangle_style);
+}
 
 /*
 Draws desired rectangle
 */
 void TG_rectangle(uint8_t x, uint8_t y, uint8_t x_size, uint8_t y_size)
 {
-	TG_line(x, x, x, y + y_size);
-	TG_line(x, y + y_size, x + x_size, y + y_size);
-	TG_line(x + x_size, y + y_size, x + x_size, y);
-	TG_line(x + x_size, y, x, y);
+	STAT_BEGIN(TG_stat_rectangle);
+	rectangle_style(x, y, x_size, y_size, 0);
+	STAT_END(TG_stat_rectangle);
+}
+
+
+//state of page aligned text written column by column
+typedef struct
+{
+	uint8_t chip; //selected chip, 0xFF when none
+	uint8_t page;
+	uint8_t next_x; //column address counter points to
+} text_stream_st;
+
+//writes column of page aligned text, address is sent only when column doesn't follow previous one
+static void stream_col(text_stream_st * stream, uint8_t page, uint8_t x, uint8_t byte)
+{
+	uint8_t chip = x / XPointsPerChip;
+	if (chip != stream->chip)
+	{
+		if (stream->chip < 3)
+			deselect_1_chip(stream->chip);
+		select_1_chip(chip);
+		stream->chip = chip;
+		stream->next_x = 0xFF;
+	}
+	if (x != stream->next_x || page != stream->page)
+	{
+		set_address(page, x % XPointsPerChip);
+		stream->page = page;
+	}
+	send_data_byte(byte);
+	stream->next_x = x + 1;
 }
 
+static void stream_end(text_stream_st * stream)
+{
+	if (stream->chip < 3)
+		deselect_1_chip(stream->chip);
+	stream->chip = 0xFF;
+}
 
 /************************************************************************/
-/* Writes text from (posX,posY) with given height of letters  and space */
+/* Writes text from (posX,posY) in font with space between letters.
+Letters of one page high font on page boundary are written without
+read-back, letters of one line (with space between them cleared) go in
+one run per chip. Other text is composed for every page and chip before
+one read-back and write                                                 */
 /************************************************************************/
-void TG_printf(uint8_t x, uint8_t y, uint8_t height, uint8_t space, const char * txt)
+static void printf_font(uint8_t x, uint8_t y, const TG_font_st * font, uint8_t space, const char * txt)
 {
-	const uint8_t (*font_ptr)[5];
-	uint8_t font_width = 0;
-	uint8_t font_height = 0;
-	if (height == 7)
+	uint8_t height = font->pages * YPointsPerPage;
+	if (0 == height || height > YPoints)
+		return;
+	TG_cmd_st cmd = {CMD_TEXT, x, y, 0, 0, space, txt, font};
+	if (list_record(CMD_TEXT, x, y, 0, 0, space, txt))
+	{
+		list_buff[list_count - 1].font = font;
+		return;
+	}
+	const uint8_t * letter;
+	uint8_t width = font_letter(font, *txt, &letter);
+	uint8_t first_x = x;
+	uint8_t first_y = y;
+	text_place(&first_x, &first_y, *txt, width, height);
+	if (*txt != '\0' && (first_y % YPointsPerPage != 0 || font->pages > 1))
+	{
+		draw_list(&cmd, 1);
+		return;
+	}
+	text_stream_st stream = {0xFF, 0, 0};
+	for (; *txt != '\0'; txt++)
 	{
-		font_ptr = default_f;
-		font_height = 8;
-		font_width = 5;
+		width = font_letter(font, *txt, &letter);
+		text_place(&x, &y, *txt, width, height);
+		if (y + height <= YPoints) //y stays aligned, letters below screen are skipped
+		{
+			uint8_t page = 0x07 & ~(y / YPointsPerPage);
+			if (stream.chip < 3 && page == stream.page && x == stream.next_x + space)
+				for (uint8_t i = 0; i < space; i++)
+					stream_col(&stream, page, stream.next_x, 0x00);
+			for (uint8_t i = 0; i < width; i++)
+				stream_col(&stream, page, x + i, letter ? TG_READ_BYTE(&letter[i]) : 0x00);
+		}
+		x += width + space;
 	}
-	while (*txt != '\0')
+	stream_end(&stream);
+}
+
+void TG_printf_font(uint8_t x, uint8_t y, const TG_font_st * font, uint8_t space, const char * txt)
+{
+	STAT_BEGIN(TG_stat_printf_font);
+	printf_font(x, y, font, space, txt);
+	STAT_END(TG_stat_printf_font);
+}
+
+/************************************************************************/
+/* Writes text in default font, height 7 is only one supported          */
+/************************************************************************/
+void TG_printf(uint8_t x, uint8_t y, uint8_t height, uint8_t space, const char * txt)
+{
+	STAT_BEGIN(TG_stat_printf);
+	if (height != 7)
+		STAT_RETURN(TG_stat_printf); //no other built-in font, see TG_printf_font
+	printf_font(x, y, &TG_font_default, space, txt);
+	STAT_END(TG_stat_printf);
+}
+
+/*
+Scrolls content up by lines with start line register of all chips
+*/
+void TG_scroll_v(uint8_t lines)
+{
+	STAT_BEGIN(TG_stat_scroll_v);
+	if (lines % YPointsPerPage) //drawing follows content by whole pages of display RAM only
+		STAT_RETURN(TG_stat_scroll_v);
+	list_flush(); //start line changes content under recorded commands
+	scroll_to((start_line + lines) % YPoints);
+	STAT_END(TG_stat_scroll_v);
+}
+
+static const TG_font_st * console_font;
+static uint8_t console_x; //column of next letter in bottom line
+
+/*
+Starts console on cleared display, lines are written at bottom
+*/
+void TG_console_init(const TG_font_st * font)
+{
+	STAT_BEGIN(TG_stat_console_init);
+	console_font = font && 1 == font->pages ? font : &TG_font_default;
+	console_x = 0;
+	clear_full();
+	list_flush();
+	scroll_to(0);
+	STAT_END(TG_stat_console_init);
+}
+
+//moves lines up by one page, top line is cleared first to come back at bottom as empty one
+static void console_newline(void)
+{
+	broadcast_fill(TG_left_disp | TG_mid_disp | TG_right_disp, 0, 1, 0, XPointsPerChip, 0x0);
+	scroll_to((start_line + YPointsPerPage) % YPoints);
+	console_x = 0;
+}
+
+/*
+Appends text to bottom line of console, wraps at right edge and new line
+character. Letters go in one run per chip with space written as blank column
+*/
+void TG_console_puts(const char * txt)
+{
+	STAT_BEGIN(TG_stat_console_puts);
+	if (0 == console_font)
+		STAT_RETURN(TG_stat_console_puts); //TG_console_init not called
+	list_flush(); //console draws directly
+	text_stream_st stream = {0xFF, 0, 0};
+	uint8_t page = YPoints / YPointsPerPage - 1;
+	for (; *txt != '\0'; txt++)
 	{
-		if (y + font_height >= YPoints)
-			y -= (y + font_height - YPoints);
-		if (x + font_width >= XPoints || (*txt == '\n'))
+		if ('\n' == *txt)
+		{
+			stream_end(&stream);
+			console_newline();
+			continue;
+		}
+		const uint8_t * letter;
+		uint8_t width = font_letter(console_font, *txt, &letter);
+		if (console_x + width > XPoints)
 		{
-			x = 0;
-			y -= font_height;
+			stream_end(&stream);
+			console_newline();
 		}
-		TG_image(x, y, font_width, font_height, font_ptr[(uint8_t)*txt]);
-		x += font_width + space;
-		txt++;
+		if (console_x != 0)
+			stream_col(&stream, page, console_x - 1, 0x00);
+		for (uint8_t i = 0; i < width; i++)
+			stream_col(&stream, page, console_x + i, letter ? TG_READ_BYTE(&letter[i]) : 0x00);
+		console_x += width + 1;
 	}
+	stream_end(&stream);
+	STAT_END(TG_stat_console_puts);
 }
 
 /*
@@ -972,6 +2076,7 @@ Prints test data on display
 */
 void TG_test(void)
 {
+	STAT_BEGIN(TG_stat_test);
 	for(int i =0; i < 8; i++)
 	{
 		test_fill_page(i,make_mask(i),TG_left_disp);
@@ -979,6 +2084,7 @@ void TG_test(void)
 		test_fill_page(i,0xFF,TG_right_disp);
 	}
 	set_start_line(0,0x7);
+	flush();
 	DELAY_MS(1000);
 	for (uint8_t i =0; i < 8; i++)
 	{
@@ -991,6 +2097,7 @@ void TG_test(void)
 		send_data(64,page_buff);
 		deselect_1_chip(2);
 	}
+	flush();
 	DELAY_MS(1000);
 	select_1_chip(0);
 	for (uint8_t i =0; i < 8; i++)
@@ -1003,10 +2110,39 @@ void TG_test(void)
 		send_data(32,page_buff);
 	}
 	deselect_1_chip(0);
+	flush();
 	DELAY_MS(1000);
-	TG_turn_off(TG_mid_disp);
-	TG_clear_area(2,2,188,60);
+	chip_command(0x3E, TG_mid_disp);
+	fill_area(2, 2, 187, 59, TG_fill_clear);
+	flush();
 	DELAY_MS(1000);
-	TG_reverse_all();
-	TG_turn_on(TG_mid_disp);
+	fill_area(0, 0, XPoints, YPoints, TG_fill_invert);
+	flush();
+	chip_command(0x3F, TG_mid_disp);
+	STAT_END(TG_stat_test);
+}
+
+/*
+Copies counters of library, zeroes when TG_STATS isn't defined
+*/
+void TG_get_stats(TG_stats_st * stats_ptr)
+{
+#ifdef TG_STATS
+	TG_LOCK; //TG_poll may count from interrupt
+	*stats_ptr = stats;
+	TG_UNLOCK;
+#else
+	TG_stats_st zero = {0};
+	*stats_ptr = zero;
+#endif
+}
+
+void TG_reset_stats(void)
+{
+#ifdef TG_STATS
+	TG_LOCK;
+	TG_stats_st zero = {0};
+	stats = zero;
+	TG_UNLOCK;
+#endif
 }
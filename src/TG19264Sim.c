@@ -0,0 +1,199 @@
+/*
+ * TG19264Sim.c
+ *
+ * Host side simulation of the TG19264A bus (3x KS0108 controllers).
+ * Every E line edge produced by the library is decoded the same way
+ * as display controller does it:
+ *  - rising edge with RW high drives data lines (status or output register),
+ *  - falling edge with RW low latches instruction or display data,
+ *  - falling edge of data read reloads output register and increments column.
+ */
+
+#ifdef TG_HOST
+
+#include <string.h>
+#include "TG19264Sim.h"
+
+#define HIGH 1
+#define BUSY_FLAG 7
+#define ON_OFF_FLAG 5
+
+volatile tg_sim_reg_st tg_sim_reg;
+tg_sim_chip_st tg_sim_chip[3];
+tg_sim_stats_st tg_sim_stats;
+
+static uint8_t last_e;
+static uint64_t now; //simulation time, not cleared with counters
+
+static inline uint8_t ctrl_bit(uint8_t num)
+{
+	return (tg_sim_reg.ctrl_port >> num) & HIGH;
+}
+
+//returns bit mask of selected chips (CS lines are active low)
+static uint8_t selected_chips(void)
+{
+	uint8_t sel = 0;
+	if (!ctrl_bit(TG_SIM_CS1))
+		sel |= 0x1;
+	if (!ctrl_bit(TG_SIM_CS2))
+		sel |= 0x2;
+	if (!ctrl_bit(TG_SIM_CS3))
+		sel |= 0x4;
+	return sel;
+}
+
+void tg_sim_clear_stats(void)
+{
+	memset(&tg_sim_stats, 0, sizeof(tg_sim_stats));
+}
+
+void tg_sim_reset(void)
+{
+	memset((void *)&tg_sim_reg, 0, sizeof(tg_sim_reg));
+	memset(tg_sim_chip, 0, sizeof(tg_sim_chip));
+	last_e = 0;
+	now = 0;
+	tg_sim_clear_stats();
+}
+
+//instruction decoding
+static void write_cmd(tg_sim_chip_st * chip, uint8_t cmd)
+{
+	if ((cmd & 0xFE) == 0x3E)
+		chip->on = cmd & 0x1;
+	else if ((cmd & 0xC0) == 0x40)
+		chip->col = cmd & 0x3F;
+	else if ((cmd & 0xF8) == 0xB8)
+		chip->page = cmd & 0x07;
+	else if ((cmd & 0xC0) == 0xC0)
+		chip->start_line = cmd & 0x3F;
+}
+
+static void rising_edge(uint8_t sel)
+{
+	tg_sim_stats.strobes++;
+	if (!ctrl_bit(TG_SIM_RW))
+		return;
+	uint8_t res = 0;
+	for (uint8_t i = 0; i < 3; i++)
+	{
+		if (!(sel & (HIGH << i)))
+			continue;
+		tg_sim_chip_st * chip = &tg_sim_chip[i];
+		if (ctrl_bit(TG_SIM_RS))
+		{
+			if (now < chip->busy_until)
+				tg_sim_stats.busy_violations++;
+			res |= chip->out_reg;
+		}
+		else
+		{
+			if (now < chip->busy_until)
+				res |= HIGH << BUSY_FLAG;
+			if (!chip->on)
+				res |= HIGH << ON_OFF_FLAG;
+		}
+	}
+	if (ctrl_bit(TG_SIM_RS))
+		tg_sim_stats.data_reads++;
+	else
+		tg_sim_stats.status_reads++;
+	tg_sim_reg.data_pin = res;
+}
+
+static void falling_edge(uint8_t sel)
+{
+	uint8_t rs = ctrl_bit(TG_SIM_RS);
+	uint8_t rw = ctrl_bit(TG_SIM_RW);
+	if (rw && !rs)
+		return;
+	if (!rw)
+	{
+		uint8_t byte = tg_sim_reg.data_port;
+		if (rs)
+			tg_sim_stats.data_writes++;
+		else
+		{
+			tg_sim_stats.cmd_writes++;
+			if ((byte & 0xC0) == 0x40 || (byte & 0xF8) == 0xB8)
+				tg_sim_stats.addr_cmds++;
+		}
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			if (!(sel & (HIGH << i)))
+				continue;
+			tg_sim_chip_st * chip = &tg_sim_chip[i];
+			if (now < chip->busy_until)
+				tg_sim_stats.busy_violations++;
+			if (rs)
+			{
+				chip->ram[chip->page][chip->col] = byte;
+				chip->col = (chip->col + 1) & 0x3F;
+			}
+			else
+				write_cmd(chip, byte);
+			chip->busy_until = now + TG_SIM_BUSY_NS;
+		}
+	}
+	else
+	{
+		for (uint8_t i = 0; i < 3; i++)
+		{
+			if (!(sel & (HIGH << i)))
+				continue;
+			tg_sim_chip_st * chip = &tg_sim_chip[i];
+			chip->out_reg = chip->ram[chip->page][chip->col];
+			chip->col = (chip->col + 1) & 0x3F;
+			chip->busy_until = now + TG_SIM_BUSY_NS;
+		}
+	}
+}
+
+void tg_sim_strobe(uint16_t ns)
+{
+	uint8_t e = ctrl_bit(TG_SIM_E);
+	if (e == last_e)
+	{
+		tg_sim_delay_ns(ns);
+		return;
+	}
+	last_e = e;
+	tg_sim_delay_ns(ns > TG_SIM_EDGE_NS ? ns : TG_SIM_EDGE_NS);
+	if (!ctrl_bit(TG_SIM_RES))
+		return;
+	uint8_t sel = selected_chips();
+	if (e)
+		rising_edge(sel);
+	else
+		falling_edge(sel);
+}
+
+void tg_sim_delay_ns(uint32_t ns)
+{
+	now += ns;
+	tg_sim_stats.time_ns += ns;
+}
+
+uint8_t tg_sim_pixel(uint8_t x, uint8_t y)
+{
+	if (x >= 192 || y >= 64)
+		return 0;
+	tg_sim_chip_st * chip = &tg_sim_chip[x / 64];
+	if (!chip->on)
+		return 0;
+	uint8_t ram_row = (63 - y + chip->start_line) & 0x3F;
+	return (chip->ram[ram_row / 8][x % 64] >> (ram_row % 8)) & HIGH;
+}
+
+void tg_sim_print(FILE * out)
+{
+	for (int8_t y = 63; y >= 0; y--)
+	{
+		for (uint8_t x = 0; x < 192; x++)
+			fputc(tg_sim_pixel(x, y) ? '#' : '.', out);
+		fputc('\n', out);
+	}
+}
+
+#endif // TG_HOST
@@ -0,0 +1,346 @@
+/*
+ * TG19264Conv.c
+ *
+ * Converts BDF fonts and PBM bitmaps into C tables in layout of TG_image / TG_font_st, runs on host.
+ * Build: gcc -O2 tools/TG19264Conv.c -o tg_conv
+ * Use:   ./tg_conv font file.bdf name [first last] > name.h
+ *        ./tg_conv image file.pbm name [x] > name.h
+ *        ./tg_conv rle file.pbm name > name.h
+ * Tables are declared with TG_PROGMEM (draw images with TG_image_P, fonts with TG_printf_font).
+ * Image rows go from top: byte [row / 8][column], bit 0 is top row of every page row, display
+ * page order is handled by library. Given x (column where image will be placed) image is split
+ * at chip boundaries into name_0, name_1... so every part is written to one chip only.
+ * rle writes image run-length coded for TG_image_rle: block starts with byte n, n < 128 is
+ * followed by n + 1 bytes to copy, n >= 128 by one byte repeated n - 127 times.
+ * Fonts get codes first..last (default 32..126), letters missing in BDF have width 0.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#define CHIP_COLS 64 //columns of one display chip
+#define MAX_SIZE 256 //max width and height of image or letter cell
+
+static uint8_t pixels[MAX_SIZE][MAX_SIZE]; //[row][column], 1 is set pixel
+
+static void fail(const char * msg)
+{
+	fprintf(stderr, "tg_conv: %s\n", msg);
+	exit(1);
+}
+
+//byte of column col in page row of pixels (height rows), LSB at top
+static uint8_t page_byte(int page, int col, int height)
+{
+	uint8_t bits = 0;
+	for (int bit = 0; bit < 8 && page * 8 + bit < height; bit++)
+		if (pixels[page * 8 + bit][col])
+			bits |= 1 << bit;
+	return bits;
+}
+
+//prints columns first..first+width-1 of pixels (height rows) as page rows
+static void print_columns(int first, int width, int height)
+{
+	for (int page = 0; page < (height + 7) / 8; page++)
+	{
+		printf("\t");
+		for (int col = first; col < first + width; col++)
+			printf("0x%02X,", page_byte(page, col, height));
+		printf("\n");
+	}
+}
+
+/************************************************************************/
+/* PBM (P1 text or P4 binary) into pixels                               */
+/************************************************************************/
+
+//next number of P1/P4 header or P1 data, comments are skipped
+static int pbm_number(FILE * file, int single_digit)
+{
+	int c;
+	do
+	{
+		c = fgetc(file);
+		if ('#' == c)
+			while (c != '\n' && c != EOF)
+				c = fgetc(file);
+	} while (' ' == c || '\t' == c || '\r' == c || '\n' == c);
+	if (c < '0' || c > '9')
+		fail("bad PBM file");
+	int value = c - '0';
+	if (single_digit)
+		return value;
+	while ((c = fgetc(file)) >= '0' && c <= '9')
+		value = value * 10 + c - '0';
+	return value;
+}
+
+static void read_pbm(FILE * file, int * width, int * height)
+{
+	char magic[2];
+	if (fread(magic, 1, 2, file) != 2 || magic[0] != 'P' || (magic[1] != '1' && magic[1] != '4'))
+		fail("only PBM images (P1, P4) are supported");
+	*width = pbm_number(file, 0);
+	*height = pbm_number(file, 0);
+	if (*width <= 0 || *height <= 0 || *width > MAX_SIZE || *height > MAX_SIZE)
+		fail("image size out of range");
+	for (int row = 0; row < *height; row++)
+	{
+		if ('1' == magic[1])
+		{
+			for (int col = 0; col < *width; col++)
+				pixels[row][col] = pbm_number(file, 1);
+			continue;
+		}
+		for (int col = 0; col < *width; col += 8)
+		{
+			int byte = fgetc(file);
+			if (EOF == byte)
+				fail("PBM data too short");
+			for (int bit = 0; bit < 8 && col + bit < *width; bit++)
+				pixels[row][col + bit] = (byte >> (7 - bit)) & 1;
+		}
+	}
+}
+
+static void convert_image(FILE * file, const char * name, int x)
+{
+	int width, height;
+	read_pbm(file, &width, &height);
+	printf("//%s: %d x %d pixels, converted by tools/TG19264Conv.c\n", name, width, height);
+	if (x < 0)
+	{
+		printf("const uint8_t %s[%d] TG_PROGMEM = {\n", name, width * ((height + 7) / 8));
+		print_columns(0, width, height);
+		printf("};\n");
+		return;
+	}
+	//one part per chip image covers when placed at column x
+	int part = 0;
+	for (int first = 0; first < width; part++)
+	{
+		int cols = CHIP_COLS - (x + first) % CHIP_COLS;
+		if (cols > width - first)
+			cols = width - first;
+		printf("//TG_image_P(%d, y, %d, %d, %s_%d);\n", x + first, cols, height, name, part);
+		printf("const uint8_t %s_%d[%d] TG_PROGMEM = {\n", name, part, cols * ((height + 7) / 8));
+		print_columns(first, cols, height);
+		printf("};\n");
+		first += cols;
+	}
+}
+
+static void convert_rle(FILE * file, const char * name)
+{
+	int width, height;
+	read_pbm(file, &width, &height);
+	static uint8_t data[MAX_SIZE * MAX_SIZE / 8];
+	int size = 0;
+	for (int page = 0; page < (height + 7) / 8; page++)
+		for (int col = 0; col < width; col++)
+			data[size++] = page_byte(page, col, height);
+	printf("//%s: %d x %d pixels, %d bytes uncompressed, converted by tools/TG19264Conv.c\n", name, width, height, size);
+	printf("const uint8_t %s[] TG_PROGMEM = {", name);
+	int out = 0;
+	int line = 16; //bytes printed on line
+	for (int i = 0; i < size; )
+	{
+		if (line >= 16)
+		{
+			printf("\n\t");
+			line = 0;
+		}
+		int run = 1;
+		while (i + run < size && run < 128 && data[i + run] == data[i])
+			run++;
+		if (run >= 2)
+		{
+			printf("0x%02X,0x%02X,", 0x80 | (run - 1), data[i]);
+			i += run;
+			out += 2;
+			line += 2;
+			continue;
+		}
+		//copied bytes end where run of 3 starts
+		int count = 1;
+		while (i + count < size && count < 128
+			&& !(i + count + 2 < size && data[i + count] == data[i + count + 1] && data[i + count] == data[i + count + 2]))
+			count++;
+		printf("0x%02X,", count - 1);
+		line++;
+		for (int j = 0; j < count; j++, line++)
+		{
+			if (line >= 16)
+			{
+				printf("\n\t");
+				line = 0;
+			}
+			printf("0x%02X,", data[i + j]);
+		}
+		i += count;
+		out += count + 1;
+	}
+	printf("\n}; //%d bytes\n", out);
+}
+
+/************************************************************************/
+/* BDF font into TG_font_st tables                                      */
+/************************************************************************/
+
+typedef struct
+{
+	int width; //advance of letter, 0 when missing
+	int bbx_w, bbx_h, bbx_x, bbx_y; //bounding box of bitmap relative to origin
+	int bitmap_rows; //rows read from BITMAP
+	uint8_t rows[MAX_SIZE][MAX_SIZE / 8]; //bitmap rows from BDF, from top
+} glyph_st;
+
+static glyph_st glyphs[256];
+
+static void read_bdf(FILE * file, int * ascent, int * descent)
+{
+	char line[1024];
+	int code = -1;
+	int row = -1; //row of BITMAP being read, -1 outside of it
+	*ascent = *descent = -1;
+	while (fgets(line, sizeof(line), file))
+	{
+		if (row >= 0)
+		{
+			if (0 == strncmp(line, "ENDCHAR", 7))
+				row = -1;
+			else if (code >= 0 && code < 256 && row < MAX_SIZE)
+			{
+				for (int i = 0; i < MAX_SIZE / 8 && line[2 * i] && line[2 * i + 1]; i++)
+				{
+					char hex[3] = {line[2 * i], line[2 * i + 1], 0};
+					glyphs[code].rows[row][i] = (uint8_t)strtol(hex, 0, 16);
+				}
+				glyphs[code].bitmap_rows = ++row;
+			}
+		}
+		else if (0 == strncmp(line, "FONT_ASCENT ", 12))
+			*ascent = atoi(line + 12);
+		else if (0 == strncmp(line, "FONT_DESCENT ", 13))
+			*descent = atoi(line + 13);
+		else if (0 == strncmp(line, "ENCODING ", 9))
+			code = atoi(line + 9);
+		else if (0 == strncmp(line, "DWIDTH ", 7) && code >= 0 && code < 256)
+		{
+			glyphs[code].width = atoi(line + 7);
+			if (glyphs[code].width < 0 || glyphs[code].width > MAX_SIZE)
+				fail("letter too wide");
+		}
+		else if (0 == strncmp(line, "BBX ", 4) && code >= 0 && code < 256)
+		{
+			glyph_st * glyph = &glyphs[code];
+			if (sscanf(line + 4, "%d %d %d %d", &glyph->bbx_w, &glyph->bbx_h, &glyph->bbx_x, &glyph->bbx_y) != 4
+				|| glyph->bbx_w < 0 || glyph->bbx_h < 0 || glyph->bbx_w > MAX_SIZE || glyph->bbx_h > MAX_SIZE)
+				fail("letter bounding box out of range");
+		}
+		else if (0 == strncmp(line, "BITMAP", 6))
+		{
+			row = 0;
+			if (code >= 0 && code < 256)
+				glyphs[code].bitmap_rows = 0;
+		}
+		else if (0 == strncmp(line, "ENDCHAR", 7))
+			code = -1;
+	}
+	if (*ascent < 0 || *descent < 0)
+		fail("BDF font without FONT_ASCENT / FONT_DESCENT");
+}
+
+//draws letter into pixels as cell of its width and font height, baseline at ascent
+static void render_glyph(const glyph_st * glyph, int ascent, int height)
+{
+	memset(pixels, 0, sizeof(pixels));
+	for (int i = 0; i < glyph->bbx_h && i < glyph->bitmap_rows; i++)
+	{
+		int row = ascent - glyph->bbx_y - glyph->bbx_h + i;
+		for (int j = 0; j < glyph->bbx_w; j++)
+		{
+			int col = glyph->bbx_x + j;
+			if (row >= 0 && row < height && col >= 0 && col < glyph->width)
+				pixels[row][col] = (glyph->rows[i][j / 8] >> (7 - j % 8)) & 1;
+		}
+	}
+}
+
+static void convert_font(FILE * file, const char * name, int first, int last)
+{
+	int ascent, descent;
+	read_bdf(file, &ascent, &descent);
+	int height = ascent + descent;
+	int pages = (height + 7) / 8;
+	if (height <= 0 || height > 64)
+		fail("font height has to be 1..64 pixels");
+	int fixed = glyphs[first].width; //width of every letter or -1 when proportional
+	for (int code = first; code <= last; code++)
+		if (glyphs[code].width != fixed)
+			fixed = -1;
+	printf("//%s: codes %d..%d, %d pixels high (%d pages), converted by tools/TG19264Conv.c\n",
+		name, first, last, height, pages);
+	printf("const uint8_t %s_bitmap[] TG_PROGMEM = {\n", name);
+	int offset = 0;
+	for (int code = first; code <= last; code++)
+	{
+		if (0 == glyphs[code].width)
+			continue;
+		printf("\t//code[%d]\n", code);
+		render_glyph(&glyphs[code], ascent, height);
+		print_columns(0, glyphs[code].width, height);
+		offset += glyphs[code].width * pages;
+	}
+	printf("};\n");
+	if (offset > 0xFFFF)
+		fail("font bitmap over 64 KB");
+	if (fixed > 0)
+	{
+		printf("const TG_font_st %s = {%d, %d, %d, %d, 0, 0, %s_bitmap};\n", name, first, last, pages, fixed, name);
+		return;
+	}
+	printf("const uint8_t %s_widths[] TG_PROGMEM = {", name);
+	for (int code = first; code <= last; code++)
+		printf("%s%d,", (code - first) % 16 ? "" : "\n\t", glyphs[code].width);
+	printf("\n};\nconst uint16_t %s_offsets[] TG_PROGMEM = {", name);
+	offset = 0;
+	for (int code = first; code <= last; code++)
+	{
+		printf("%s%d,", (code - first) % 16 ? "" : "\n\t", offset);
+		offset += glyphs[code].width * pages;
+	}
+	printf("\n};\n");
+	printf("const TG_font_st %s = {%d, %d, %d, %d, %s_widths, %s_offsets, %s_bitmap};\n",
+		name, first, last, pages, glyphs[' '].width, name, name, name);
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc < 4 || (strcmp(argv[1], "font") && strcmp(argv[1], "image") && strcmp(argv[1], "rle")))
+	{
+		fprintf(stderr, "use: tg_conv font file.bdf name [first last]\n     tg_conv image file.pbm name [x]\n"
+			"     tg_conv rle file.pbm name\n");
+		return 1;
+	}
+	FILE * file = fopen(argv[2], "rb");
+	if (!file)
+		fail("can't open input file");
+	if (0 == strcmp(argv[1], "image"))
+		convert_image(file, argv[3], argc > 4 ? atoi(argv[4]) : -1);
+	else if (0 == strcmp(argv[1], "rle"))
+		convert_rle(file, argv[3]);
+	else
+	{
+		int first = argc > 5 ? atoi(argv[4]) : 32;
+		int last = argc > 5 ? atoi(argv[5]) : 126;
+		if (first < 0 || last > 255 || first > last)
+			fail("codes have to be 0..255, first <= last");
+		convert_font(file, argv[3], first, last);
+	}
+	fclose(file);
+	return 0;
+}
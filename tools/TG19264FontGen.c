@@ -0,0 +1,53 @@
+/*
+ * TG19264FontGen.c
+ *
+ * Generates include/TG19264FontShift.h (used with TG_SHIFTED_FONT) from default_f, runs on host.
+ * Build: gcc -O2 -Iinclude tools/TG19264FontGen.c -o tg_fontgen && ./tg_fontgen > include/TG19264FontShift.h
+ * Run again after default_f is changed.
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include "TG19264ALib.h"
+#define TG_PROGMEM //table is only read on host
+#include "TG19264Fonts.h"
+
+#define FIRST_CODE 32 //first letter of default_f
+#define SHIFTS 7 //letter moved down by 1..7 rows from page boundary
+
+int main(void)
+{
+	printf("/*\n * TG19264FontShift.h\n *\n");
+	printf(" * Generated by tools/TG19264FontGen.c from default_f, do not edit.\n */\n\n");
+	printf("#ifndef FONT_SHIFT_H_\n#define FONT_SHIFT_H_\n\n");
+	printf("//letter at row y (y %% 8 = shift) covers 2 pages, [shift - 1][half] is part in page of\n");
+	printf("//its top row (half 0) or of row y (half 1)\n");
+	printf("const uint8_t default_f_shift_mask[%d][2] TG_PROGMEM = {\n", SHIFTS);
+	for (int shift = 1; shift <= SHIFTS; shift++)
+		printf("\t{0x%02X,0x%02X}, //shift %d\n", 0xFF & (0xFF << (8 - shift)), 0xFF >> shift, shift);
+	printf("};\n\n");
+	printf("//columns of letters %d..127, [shift - 1][code - %d][half]\n", FIRST_CODE, FIRST_CODE);
+	printf("const uint8_t default_f_shift[%d][%d][2][5] TG_PROGMEM = {\n", SHIFTS, 128 - FIRST_CODE);
+	for (int shift = 1; shift <= SHIFTS; shift++)
+	{
+		printf("\t{ //shift %d\n", shift);
+		for (int code = FIRST_CODE; code < 128; code++)
+		{
+			printf("\t\t{");
+			for (int half = 0; half < 2; half++)
+			{
+				printf("{");
+				for (int col = 0; col < 5; col++)
+				{
+					uint8_t bits = half ? default_f[code - FIRST_CODE][col] >> shift : 0xFF & (default_f[code - FIRST_CODE][col] << (8 - shift));
+					printf(col ? ",0x%02X" : "0x%02X", bits);
+				}
+				printf(half ? "}" : "},");
+			}
+			printf("}, //code[%d]\n", code);
+		}
+		printf("\t},\n");
+	}
+	printf("};\n\n#endif /* FONT_SHIFT_H_ */\n");
+	return 0;
+}